@@ -43,6 +43,9 @@
 #define EEPROM_TIMEOUT		(5 * EEPROM_WRITE)  // timeout while writing
 #define EEPROM_SIZE			256
 
+/* EEPROM map */
+#define EEPROM_TOUCH_CAL	0x00	// touch calibration record, 32 bytes, see ui.c
+
 extern I2C_HandleTypeDef hi2c1;
 
 HAL_StatusTypeDef readEEPROM(uint16_t address, uint8_t* MemTarget,
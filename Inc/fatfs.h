@@ -68,6 +68,25 @@ void deviceSelect(dselect_t device);
 void deviceDeselect();
 
 FRESULT transferFile(const TCHAR *source, const TCHAR *dest, uint8_t overwrite);
+uint32_t updateCRC32(uint32_t crc, const void *data, size_t size);
+FRESULT crcFile(const TCHAR *path, uint32_t *pSize, uint32_t *pCrc);
+
+/* incremental copy, see syncFile() */
+
+#define SYNC_LINE	64		// manifest line, the destination path is limited by it
+
+typedef struct {
+	const TCHAR *manifest;	// NULL - not open
+	TCHAR next[32];			// manifest being rebuilt, manifest path + "~"
+	FIL *pManifest;
+	FIL *pNext;
+	uint16_t copied;
+	uint16_t failed;
+} sync_t;
+
+FRESULT beginSync(sync_t *pSync, const TCHAR *manifest);
+FRESULT syncFile(sync_t *pSync, const TCHAR *source, const TCHAR *dest, uint8_t *pCopied);
+FRESULT endSync(sync_t *pSync);
 
 /* USER CODE END Prototypes */
 #ifdef __cplusplus
@@ -0,0 +1,86 @@
+/**
+  ******************************************************************************
+  * File Name          : latency.h
+  * Description        : This file provides the touch latency tracer
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LATENCY_H
+#define __LATENCY_H
+
+#include <stddef.h>
+#include "stm32f1xx_hal.h"
+
+#define LATENCY_TRACE	0	// 1 - DWT stamps along the touch path, see Set>About, long press
+
+/*
+ * touch latency: the DWT cycle counter stamps a touch at every stage from
+ * the TOUCH_DI edge to the first pixel the UI writes for it. The
+ * stages up to the first sample are those of the pen going down; queue,
+ * beep and pixel follow the last touch event before the first pixel (a
+ * tap draws on release, so "sample>evt" holds the time the pen is down).
+ * Every stage keeps a histogram of half octave buckets from 1 us to 1 s,
+ * halved each LATENCY_WINDOW traces, which keeps the percentiles rolling.
+ * A touch that never draws counts for the stages it reached
+ * */
+
+#define LATENCY_WINDOW	64		// traces between halving the histograms
+#define LATENCY_BUCKETS	40		// half octaves, the last one takes the rest
+#define LATENCY_LINE	41		// latencyFormat() line, with the terminator
+
+typedef enum {
+	LATENCY_EDGE = 0,		// EXTI on TOUCH_DI
+	LATENCY_TASK,			// touch task woken
+	LATENCY_SAMPLE,			// first sample of the stream
+	LATENCY_QUEUED,			// touch event in the UI queue
+	LATENCY_DEQUEUED,		// UI task took it
+	LATENCY_BEEP,			// uiShortBeep() returned
+	LATENCY_PIXEL,			// first GRAM write to the panel
+	LATENCY_DONE,			// event processed
+	LATENCY_STAGES
+} xLatencyStage_t;
+
+#define LATENCY_ROWS	9		// rows of latencyFormat(): the stages, event>pixel, total
+
+#if LATENCY_TRACE
+void latencyInit(void);
+void latencyEdge(void);
+void latencyMark(uint8_t stage);
+void latencyEnd(void);
+void latencyReset(void);
+void latencyFormat(int row, char *buffer, size_t size);
+#else
+#define latencyInit()		do {} while (0)
+#define latencyEdge()		do {} while (0)
+#define latencyMark(stage)	do {} while (0)
+#define latencyEnd()		do {} while (0)
+#endif /* LATENCY_TRACE */
+
+#endif /* __LATENCY_H */
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -1,7 +1,7 @@
 /**
   ******************************************************************************
   * File Name          : lcd.h
-  * Description        : This file contains useful stuff for ILI9325 LCD
+  * Description        : This file contains useful stuff for ILI9325/ILI9341/ST7789 LCD
   ******************************************************************************
   *
   * COPYRIGHT(c) 2016 Roman Stepanov
@@ -34,10 +34,15 @@
 #ifndef __LCD_H
 #define __LCD_H
 
-#include "stm32f1xx_hal.h"
+#ifndef LCD_HOST
+#define LCD_HOST	0	// 1 - Linux build, ILI9325 emulated in memory by lcd_host.c
+#endif
 
-#define LCD_MAX_X	((Lcd_Orientation() & 1) ?  320 : 240)
-#define LCD_MAX_Y	((Lcd_Orientation() & 1) ?  240 : 320)
+#if LCD_HOST
+#include "lcd_host.h"
+#else
+#include "stm32f1xx_hal.h"
+#endif
 
 typedef enum {
 	LCD_PORTRAIT_CDN = 0,	/* portrait, connector side is down */
@@ -47,19 +52,176 @@ typedef enum {
 } lcd_orientation_t;
 
 #define MIN(a,b) (((a) < (b)) ? (a) : (b))
+#define MAX(a,b) (((a) > (b)) ? (a) : (b))
+
+#define LCD_BENCHMARK	0	// 1 - build Lcd_Benchmark() (results on "About" screen)
+#define LCD_STRIP_BUDGET	(320 * 16 * 2)	// bytes of heap per strip renderer band
+#define LCD_PUMP		0	// 1 - TIM1/DMA1 strobe fills and Lcd_Pump_Pixels() (PB14 = TIM1_CH2N)
+
+/*
+ * fixed orientation builds (opt in, e.g. -DLCD_ORIENTATION=3 for
+ * LCD_LANDSCAPE_CL): screen bounds and the GRAM address mapping are
+ * constants, Lcd_Init() ignores its argument. The default -1 keeps the
+ * orientation set at run time by Lcd_Init()
+ * */
 
+#ifndef LCD_ORIENTATION
+#define LCD_ORIENTATION	-1	// -1 - set by Lcd_Init(), 0..3 - fixed lcd_orientation_t
+#endif
+
+#if LCD_ORIENTATION >= 0
+#define Lcd_Orientation()	((uint8_t) LCD_ORIENTATION)
+#else
 uint8_t Lcd_Orientation(void);
+#endif
+
+#define LCD_MAX_X	((Lcd_Orientation() & 1) ?  320 : 240)
+#define LCD_MAX_Y	((Lcd_Orientation() & 1) ?  240 : 320)
 
 #define TOUCH_X_LOW		1700
 #define TOUCH_X_HIGH	30000
 #define TOUCH_Y_LOW		2000
 #define TOUCH_Y_HIGH	30000
 
-short Lcd_Touch_Get_Closest_Average(uint16_t *d3);
 void Lcd_Translate_Touch_Pos(uint16_t raw_x, uint16_t raw_y, uint16_t *x,
 		uint16_t *y);
 
+/*
+ * touch calibration: raw positions map to screen pixels through a 2x3
+ * affine matrix in fixed point, multiplies and a shift per axis:
+ *
+ *	x = (a * raw_x + b * raw_y + c) >> LCD_TOUCH_CAL_SHIFT
+ *	y = (d * raw_x + e * raw_y + f) >> LCD_TOUCH_CAL_SHIFT
+ *
+ * Lcd_Touch_Calibrate() fits the matrix to 3 points exactly or to up to
+ * LCD_TOUCH_CAL_POINTS by least squares. Without a calibration, or with
+ * one taken in another orientation, the matrix follows TOUCH_X/Y_LOW/HIGH
+ * */
+
+#define LCD_TOUCH_CAL_SHIFT		16
+#define LCD_TOUCH_CAL_POINTS	5		// points Lcd_Touch_Calibrate() takes at most
+#define LCD_TOUCH_CAL_INSET		32		// px, calibration targets from the screen edges
+
+typedef struct {
+	uint16_t x;
+	uint16_t y;
+} touch_point_t;
+
+typedef struct {
+	int32_t a, b, c;
+	int32_t d, e, f;
+	uint8_t orientation;	// lcd_orientation_t the matrix is for
+} touch_cal_t;
+
+uint8_t Lcd_Touch_Calibrate(const touch_point_t *raw, const touch_point_t *screen,
+		uint8_t points, touch_cal_t *cal);
+void Lcd_Touch_Set_Calibration(const touch_cal_t *cal);
+void Lcd_Touch_Map(const touch_cal_t *cal, uint16_t raw_x, uint16_t raw_y,
+		int16_t *x, int16_t *y);
+
+/*
+ * touch sampler (XPT2046 on SPI3): from Lcd_Touch_Start() on, TIM6 starts a
+ * conversion frame LCD_TOUCH_RATE times a second and DMA2 runs it: Z1, Z2,
+ * then LCD_TOUCH_FILTER conversions per axis, median (or trimmed mean).
+ * A frame counts as a touch if Z1 and the touch resistance computed from
+ * Z1/Z2 say so, which rejects light and ghost touches. Every accepted frame
+ * is queued as a timestamped sample; the stream ends with one TOUCH_UP
+ * sample (x = y = 0 if nothing was accepted) and the sampler stops
+ * */
+
+#define LCD_TOUCH_RATE		200		// frames/s while the pen is down
+#define LCD_TOUCH_FILTER	5		// conversions per axis and frame, odd
+#define LCD_TOUCH_MEAN		0		// 1 - trimmed mean instead of the median
+#define LCD_TOUCH_Z1_MIN	64		// 12 bit Z1 below - no contact
+#define LCD_TOUCH_R_MAX		48		// touch resistance above - too light, Rx-plate / 16
+#define LCD_TOUCH_UP_FRAMES	3		// frames without a touch that end the stream
+
+typedef enum {
+	TOUCH_UP = 0,
+	TOUCH_DOWN,
+	TOUCH_MOVE
+} touch_state_t;
+
+typedef struct {
+	uint32_t time;			// HAL_GetTick() of the frame, ms
+	uint16_t x;				// raw, as Lcd_Translate_Touch_Pos() takes them
+	uint16_t y;
+	uint16_t resistance;	// Rx-plate / 16, lower - firmer
+	uint8_t state;			// touch_state_t
+} touch_sample_t;
+
+#if !LCD_HOST
+void Lcd_Touch_Init(void);
+void Lcd_Touch_Start(void);
+uint8_t Lcd_Touch_Read(touch_sample_t *sample, uint32_t timeout);
+void Lcd_Touch_Timer_IRQHandler(void);
+void Lcd_Touch_DMA_IRQHandler(void);
+#endif /* !LCD_HOST */
+
+/*
+ * gesture recognizer: fed with the sample stream in screen pixels, one
+ * sample at a time, integer math only. A pen that stays within
+ * LCD_GESTURE_SLOP of where it went down taps on release, unless it was held
+ * long enough for a LONG_PRESS, which takes the place of the tap; once it leaves the
+ * slop it drags, every sample with a new position is a MOVE. On release a
+ * quick stroke is a SWIPE, a drag still moving at LCD_GESTURE_FLING_MIN is
+ * a FLING. Velocities are taken over the last LCD_GESTURE_VELOCITY_MS
+ * */
+
+#define LCD_GESTURE_SLOP		8		// px, tap vs. drag
+#define LCD_GESTURE_LONG_MS		600		// held without a drag - long press
+#define LCD_GESTURE_SWIPE_MS	300		// down to up, a stroke not longer is a swipe
+#define LCD_GESTURE_SWIPE_MIN	40		// px along the stroke to count as a swipe
+#define LCD_GESTURE_FLING_MIN	300		// px/s at release to count as a fling
+#define LCD_GESTURE_VELOCITY_MS	80		// window the release velocity is taken over
+#define LCD_GESTURE_HISTORY		16		// samples kept for it, >= window * rate
+
+typedef enum {
+	GESTURE_NONE = 0,
+	GESTURE_MOVE,			// dx, dy: px since the last MOVE
+	GESTURE_TAP,
+	GESTURE_LONG_PRESS,
+	GESTURE_SWIPE_LEFT,		// dx, dy: px/s at release
+	GESTURE_SWIPE_RIGHT,
+	GESTURE_SWIPE_UP,
+	GESTURE_SWIPE_DOWN,
+	GESTURE_FLING			// dx, dy: px/s at release
+} gesture_type_t;
+
+typedef struct {
+	uint8_t type;			// gesture_type_t
+	int16_t x;				// pen position, px
+	int16_t y;
+	int16_t dx;
+	int16_t dy;
+} gesture_t;
+
+typedef struct {
+	uint32_t down;			// time the pen went down
+	int16_t x0, y0;			// where
+	int16_t x, y;			// last position, reported by MOVE once dragging
+	uint8_t flags;
+	uint8_t head;			// history ring
+	uint8_t count;
+	struct {
+		uint32_t time;
+		int16_t x, y;
+	} history[LCD_GESTURE_HISTORY];
+} gesture_state_t;
+
+void Lcd_Gesture_Reset(gesture_state_t *state);
+uint8_t Lcd_Gesture_Feed(gesture_state_t *state, uint32_t time, int16_t x, int16_t y,
+		uint8_t touch, gesture_t *gesture);
+
+/*
+ * controllers: Lcd_Init() reads the controller ID and picks the driver,
+ * ILI9325 (also ILI9328), ILI9341 or ST7789; an unknown ID falls back to
+ * ILI9325. Lcd_Read_Id() returns 0x9325, 0x9341, 0x7789 or the raw R00h.
+ * Lcd_Com(), Lcd_Go_XY() and the window calls below are ILI9325 registers.
+ * */
+
 void Lcd_Init(uint8_t orientation);
+const char *Lcd_Controller(void);
 void Lcd_Com(uint16_t com);
 void Lcd_Set_Data(uint16_t data);
 uint16_t Lcd_Get_Data();
@@ -69,13 +231,76 @@ void Lcd_Go_XY(uint16_t x, uint16_t y);
 void Lcd_Put_Pix(uint16_t x, uint16_t y, uint16_t col);
 uint16_t Lcd_Get_Pix(uint16_t x, uint16_t y);
 void Lcd_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t c);
+void Lcd_HLine(uint16_t x, uint16_t y, uint16_t width, uint16_t color);
+void Lcd_VLine(uint16_t x, uint16_t y, uint16_t height, uint16_t color);
+void Lcd_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
+void Lcd_Round_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t r,
+		uint16_t color);
+void Lcd_Fill_Round_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t r,
+		uint16_t color);
+void Lcd_Circle(uint16_t xc, uint16_t yc, uint16_t r, uint16_t color);
+void Lcd_Fill_Circle(uint16_t xc, uint16_t yc, uint16_t r, uint16_t color);
+void Lcd_Arc(uint16_t xc, uint16_t yc, uint16_t r_outer, uint16_t r_inner,
+		int16_t start, int16_t end, uint16_t color);
 void Lcd_Fill_Screen(uint16_t color);
 void Lcd_Fill_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2,
 		uint16_t color);
 void Lcd_Copy_Region(uint16_t x1, uint16_t y1, uint16_t width, uint16_t height,
 		uint16_t x2, uint16_t y2);
+void Lcd_Read_Region(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint16_t *buffer);
 uint16_t Lcd_Get_RGB565(uint8_t red, uint8_t green, uint8_t blue);
 
+/*
+ * pixel streaming: Lcd_Stream_Begin() opens a GRAM window and leaves the bus
+ * in data mode, pixels are written left-to-right, top-to-bottom with nWR
+ * strobes only; the full-screen window is restored on demand by the cursor
+ * addressed primitives or by Lcd_Reset_Window()
+ * */
+
+void Lcd_Set_Window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+void Lcd_Reset_Window(void);
+
+void Lcd_Stream_Begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height);
+void Lcd_Stream_Pixels(const uint16_t *pixels, uint32_t count);
+void Lcd_Stream_Fill(uint16_t color, uint32_t count);
+void Lcd_Stream_Indexed(const uint8_t *indices, uint32_t count, uint8_t bpp,
+		const uint16_t *palette);
+void Lcd_Stream_End(void);
+
+/*
+ * pixel pump (LCD_PUMP): fills and pixel buffers are strobed by TIM1 and fed
+ * by DMA1 while the CPU runs; Lcd_Stream_Fill() hands long fills over to it,
+ * the next bus access waits for the pump to finish
+ * */
+
+#if LCD_PUMP && !LCD_HOST
+typedef void (*lcd_pump_done_t)(void *context);
+
+void Lcd_Pump_Init(void);
+void Lcd_Pump_Pixels(const uint16_t *pixels, uint32_t count,
+		lcd_pump_done_t done, void *context);
+void Lcd_Pump_Fill(uint16_t color, uint32_t count, lcd_pump_done_t done, void *context);
+uint8_t Lcd_Pump_Busy(void);
+void Lcd_Pump_Wait(void);
+void Lcd_Pump_IRQHandler(void);
+#endif /* LCD_PUMP */
+
+#if LCD_BENCHMARK
+typedef struct {
+	uint32_t setData;		// pixels/s, Lcd_Set_Data() per pixel
+	uint32_t streamFill;	// pixels/s, Lcd_Stream_Fill()
+	uint32_t streamPixels;	// pixels/s, Lcd_Stream_Pixels()
+#if LCD_PUMP && !LCD_HOST
+	uint32_t pumpFill;		// pixels/s, Lcd_Pump_Fill()
+	uint32_t pumpPixels;	// pixels/s, Lcd_Pump_Pixels() of 256 pixel buffers
+	uint32_t pumpCpuFree;	// %, CPU left to other work during Lcd_Pump_Fill()
+#endif
+} lcd_benchmark_t;
+
+void Lcd_Benchmark(lcd_benchmark_t *result);
+#endif /* LCD_BENCHMARK */
+
 extern unsigned char cp866_8x8_psf[256][8];
 extern unsigned char cp866_8x14_psf[256][14];
 extern unsigned char cp866_8x16_psf[256][16];
@@ -86,9 +311,70 @@ typedef enum {
 	FONT_8x16 = 16
 } font_size_t;
 
+/*
+ * compiled fonts (tools/fontgen.py -> Src/fonts.c): proportional glyphs,
+ * run-length coded, 1 bit or 2/4 bit alpha blended against bgcolor
+ * */
+
+typedef struct {
+	uint16_t offset;	// first run in font_t.data
+	uint8_t width;		// 0 - no bitmap
+	uint8_t advance;	// 0 - glyph not in the font
+} font_glyph_t;
+
+typedef struct {
+	uint8_t height;
+	uint8_t bpp;		// 1, 2 or 4
+	uint8_t first;
+	uint8_t last;
+	const font_glyph_t *glyphs;
+	const uint8_t *data;
+} font_t;
+
+uint16_t Lcd_Font_Text_Width(const font_t *font, const char *text);
+uint16_t Lcd_Put_Font_Text(uint16_t x, uint16_t y, const font_t *font,
+		const char *text, uint16_t color, uint16_t bgcolor);
+
 void Lcd_Render_Bitmap_8xN(uint16_t x, uint16_t y, uint8_t height, uint8_t *bitmap,
 		uint16_t color);
+#define MAXTEXTLEN	(320 / 8)	// longest opaque string, one screen row
+
 void Lcd_Put_Text(uint16_t x, uint16_t y, uint8_t height, char *text, uint16_t color);
+void Lcd_Put_Text_Opaque(uint16_t x, uint16_t y, uint8_t height, char *text,
+		uint16_t color, uint16_t bgcolor);
+
+/*
+ * strip renderer: compose a band of up to LCD_STRIP_BUDGET bytes in RAM, then
+ * flush it with one burst; every pixel reaches the bus once per frame
+ *
+ *	if (Lcd_Strip_Begin(&strip, x, y, width, height)) do {
+ *		... Lcd_Strip_* drawing of the whole area, clipped to the band ...
+ *	} while (Lcd_Strip_Next(&strip));
+ * */
+
+typedef struct {
+	uint16_t x, y, width, height;	// current band on the screen
+	uint16_t *pixels;				// width * height, row by row
+	uint16_t rows;					// band height
+	uint16_t end;					// last row + 1 of the area
+} lcd_strip_t;
+
+typedef void (*lcd_strip_reader_t)(void *context, uint32_t offset,
+		uint16_t *pixels, uint16_t count);
+
+uint8_t Lcd_Strip_Begin(lcd_strip_t *strip, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height);
+uint8_t Lcd_Strip_Next(lcd_strip_t *strip);
+void Lcd_Strip_Fill_Rect(lcd_strip_t *strip, uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2, uint16_t color);
+void Lcd_Strip_Blend_Rect(lcd_strip_t *strip, uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2, uint16_t color, uint8_t alpha);
+void Lcd_Strip_Image(lcd_strip_t *strip, uint16_t x, uint16_t y, uint16_t width,
+		uint16_t height, lcd_strip_reader_t reader, void *context);
+void Lcd_Strip_Text(lcd_strip_t *strip, uint16_t x, uint16_t y, uint8_t height,
+		const char *text, uint16_t color);
+uint16_t Lcd_Strip_Font_Text(lcd_strip_t *strip, uint16_t x, uint16_t y,
+		const font_t *font, const char *text, uint16_t color);
 
 /**
   * @}
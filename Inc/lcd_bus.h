@@ -0,0 +1,192 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_bus.h
+  * Description        : This file contains the display bus backends used by lcd.c
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LCD_BUS_H
+#define __LCD_BUS_H
+
+#include "lcd.h"
+
+/*
+ * display backend: everything lcd.c puts on the bus goes through these
+ * operations, the backend is chosen at compile time so the pixel loops
+ * keep inlined GPIO access on the target
+ *
+ *	lcd_bus_sync()			wait for background transfers (pixel pump)
+ *	lcd_bus_select()		panel powered and selected
+ *	lcd_bus_com(addr)		index register write, RS low
+ *	lcd_bus_data_mode()		RS high, following writes/reads are data
+ *	lcd_bus_write(data)		one data word
+ *	lcd_bus_repeat(count)	the last data word count more times
+ *	lcd_bus_input()			data lines to input for reads
+ *	lcd_bus_read()			one data word
+ *	lcd_bus_output()		data lines back to output
+ * */
+
+#if LCD_HOST
+
+void lcd_host_select(void);
+void lcd_host_com(uint16_t addr);
+void lcd_host_write(uint16_t data);
+void lcd_host_repeat(uint32_t count);
+uint16_t lcd_host_read(void);
+
+#define lcd_bus_sync()			do {} while (0)
+#define lcd_bus_select()		lcd_host_select()
+#define lcd_bus_com(addr)		lcd_host_com(addr)
+#define lcd_bus_data_mode()		do {} while (0)
+#define lcd_bus_write(data)		lcd_host_write(data)
+#define lcd_bus_repeat(count)	lcd_host_repeat(count)
+#define lcd_bus_input()			do {} while (0)
+#define lcd_bus_read()			lcd_host_read()
+#define lcd_bus_output()		do {} while (0)
+#define lcd_bus_gram_mark()		do {} while (0)
+
+#else /* ILI9325, 16 bit 8080 bus on GPIOE */
+
+#include "latency.h"
+
+/*
+ * direct register access for the pixel loops, HAL_GPIO_WritePin() is too
+ * expensive to be called per pixel
+ * */
+
+#define LCD_WR_STROBE()	do { \
+		LCD_nWR_GPIO_Port->BSRR = (uint32_t)LCD_nWR_Pin << 16; \
+		LCD_nWR_GPIO_Port->BSRR = LCD_nWR_Pin; \
+	} while (0)
+
+__STATIC_INLINE void lcd_bus_select(void) {
+	HAL_GPIO_WritePin(LCD_BACKLIGHT_GPIO_Port, LCD_BACKLIGHT_Pin, GPIO_PIN_SET);
+	HAL_GPIO_WritePin(LCD_nCS_GPIO_Port, LCD_nCS_Pin, GPIO_PIN_RESET);
+}
+
+/* the pixel pump owns nWR and the data lines until it is done */
+
+#if LCD_PUMP
+#define lcd_bus_sync()	Lcd_Pump_Wait()
+#else
+#define lcd_bus_sync()	do {} while (0)
+#endif
+
+__STATIC_INLINE void lcd_bus_com(uint16_t addr) {
+	lcd_bus_sync();
+
+	LCD_nWR_GPIO_Port->BSRR = LCD_nWR_Pin;
+	LCD_nRD_GPIO_Port->BSRR = LCD_nRD_Pin;
+	LCD_RS_GPIO_Port->BSRR  = (uint32_t)LCD_RS_Pin << 16;
+
+	GPIOE->ODR = addr;
+	LCD_WR_STROBE();
+}
+
+__STATIC_INLINE void lcd_bus_data_mode(void) {
+	lcd_bus_sync();
+	LCD_nWR_GPIO_Port->BSRR = LCD_nWR_Pin;
+	LCD_nRD_GPIO_Port->BSRR = LCD_nRD_Pin;
+	LCD_RS_GPIO_Port->BSRR  = LCD_RS_Pin;
+}
+
+/* drivers' begin() after the GRAM write command: pixels of a touch reach the panel */
+#define lcd_bus_gram_mark()	latencyMark(LATENCY_PIXEL)
+
+__STATIC_INLINE void lcd_bus_write(uint16_t data) {
+	GPIOE->ODR = data;
+	LCD_WR_STROBE();
+}
+
+__STATIC_INLINE void lcd_bus_repeat(uint32_t count) {
+
+	// data lines keep the word, strobe only
+	for (; count >= 8; count -= 8) {
+		LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE();
+		LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE(); LCD_WR_STROBE();
+	}
+
+	while (count--) {
+		LCD_WR_STROBE();
+	}
+}
+
+__STATIC_INLINE void lcd_bus_input(void) {
+	lcd_bus_sync();
+	GPIOE->CRH = 0x44444444u;
+	GPIOE->CRL = 0x44444444u;
+}
+
+__STATIC_INLINE uint16_t lcd_bus_read(void) {
+
+	uint16_t data;
+
+	LCD_nRD_GPIO_Port->BSRR = (uint32_t)LCD_nRD_Pin << 16;
+	__NOP(); __NOP(); __NOP(); __NOP(); __NOP(); __NOP();	// tRDL
+	data = GPIOE->IDR;
+	LCD_nRD_GPIO_Port->BSRR = LCD_nRD_Pin;
+
+	return data;
+}
+
+__STATIC_INLINE void lcd_bus_output(void) {
+	GPIOE->CRH = 0x33333333u;
+	GPIOE->CRL = 0x33333333u;
+}
+
+#endif /* LCD_HOST */
+
+/*
+ * controller driver: how a panel is brought up and how a GRAM burst is
+ * addressed, lcd.c picks one by Lcd_Read_Id() and every primitive goes
+ * through begin(), so each controller uses its cheapest windowing
+ *
+ *	init(orientation)		power up sequence, scan direction, display on
+ *	begin(x, y, w, h, read)	window and start address, memory write (or read)
+ *							command issued, bus left in data mode
+ *	read(buffer, count)		pixels of a read burst in RGB565, dummy included
+ * */
+
+typedef struct {
+	uint16_t id;
+	const char *name;
+	void (*init)(uint8_t orientation);
+	void (*begin)(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t read);
+	void (*read)(uint16_t *buffer, uint32_t count);
+} lcd_driver_t;
+
+/* MIPI DCS controllers, lcd_dcs.c */
+
+extern const lcd_driver_t lcd_ili9341_driver;
+extern const lcd_driver_t lcd_st7789_driver;
+
+uint32_t lcd_dcs_read_id(uint8_t cmd);
+
+#endif /* __LCD_BUS_H */
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_host.h
+  * Description        : This file contains the host (Linux) display backend interface
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __LCD_HOST_H
+#define __LCD_HOST_H
+
+/*
+ * host build (-DLCD_HOST=1): lcd.c runs against an emulated ILI9325 with its
+ * GRAM in memory; the firmware headers are replaced by the few shims below
+ * */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define __STATIC_INLINE		static inline
+#define __NOP()				do {} while (0)
+#define osDelay(ms)			((void)(ms))
+#define pvPortMalloc(size)	malloc(size)
+#define vPortFree(ptr)		free(ptr)
+
+uint32_t HAL_GetTick(void);
+
+typedef struct {
+	uint32_t commands;	// index register writes
+	uint32_t data;		// data words written: register values and pixels
+	uint32_t reads;		// data words read, dummy reads included
+	uint32_t windows;	// window register (R50h..R53h) writes
+} lcd_host_stats_t;
+
+void Lcd_Host_Stats(lcd_host_stats_t *stats, uint8_t reset);
+int Lcd_Host_Dump_PPM(const char *path);
+
+#endif /* __LCD_HOST_H */
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -40,6 +40,33 @@
 
 #define WFLASH_FAST_READ	0		// 0 - use cmd 0x03 to read, 1 - 0x0b
 #define WFLASH_STATIC_BUF	0		// 0 - use pvPortMalloc, 1 - static buffer
+#define WFLASH_DMA			1		// 1 - startReadFLASH() on DMA1 channels 2/3
+
+/*
+ * flash layout: the FAT volume (0:/) takes the low sectors, the top
+ * WFLASH_ASSET_SECTORS are a raw asset region read without FatFs. The region
+ * starts with a header sector (magic, size, CRC-32 of the data), the data
+ * follows. Changing the layout needs the flash to be formatted again, the
+ * asset install from SD does that.
+ * */
+
+#define WFLASH_SECTORS			512		// W25Q16, 2M
+#define WFLASH_ASSET_SECTORS	0		// 0 - whole flash is FAT, e.g. 256 - 1M raw assets
+#define WFLASH_FAT_SECTORS		(WFLASH_SECTORS - WFLASH_ASSET_SECTORS)
+
+#if WFLASH_ASSET_SECTORS
+#define WFLASH_ASSET_BASE		(WFLASH_FAT_SECTORS * WFLASH_SECTOR_SIZE)
+#define WFLASH_ASSET_DATA		(WFLASH_ASSET_BASE + WFLASH_SECTOR_SIZE)
+#define WFLASH_ASSET_MAX		((WFLASH_ASSET_SECTORS - 1) * WFLASH_SECTOR_SIZE)
+#define WFLASH_ASSET_MAGIC		"MKSA"
+
+typedef struct {
+	char magic[4];
+	uint32_t size;				// data bytes
+	uint32_t crc;				// CRC-32 of the data
+	uint32_t reserved;
+} wflash_asset_header_t;
+#endif /* WFLASH_ASSET_SECTORS */
 
 /*
  * generic interface
@@ -53,6 +80,31 @@ HAL_StatusTypeDef programFLASHPage(uint32_t address, const uint8_t* buffer, uint
 HAL_StatusTypeDef powerOnFLASH();
 HAL_StatusTypeDef powerOffFLASH();
 
+/*
+ * streamed read: one read command, chip select held and task switches
+ * suspended (other tasks share SPI1) until endReadFLASH(), interrupts stay on
+ * */
+
+HAL_StatusTypeDef beginReadFLASH(uint32_t address);
+HAL_StatusTypeDef continueReadFLASH(uint8_t* buffer, size_t size);
+void endReadFLASH();
+
+#if WFLASH_DMA == 1
+/*
+ * inside a streamed read: startReadFLASH() returns at once, the bytes arrive
+ * by DMA; the buffer is valid after waitReadFLASH()
+ * */
+
+HAL_StatusTypeDef startReadFLASH(uint8_t* buffer, size_t size);
+HAL_StatusTypeDef waitReadFLASH();
+#endif /* WFLASH_DMA == 1 */
+
+#if WFLASH_ASSET_SECTORS
+uint32_t openFLASHAssets();
+FRESULT installFLASHAssets(const TCHAR *source);
+FRESULT removeFLASHAssets();
+#endif /* WFLASH_ASSET_SECTORS */
+
 /*
  * FatFs interface
  *
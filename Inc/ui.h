@@ -51,18 +51,15 @@ typedef struct
 {
     enum {
     	INIT_EVENT = 0,
-		UPDATE1_EVENT,
-		UPDATE2_EVENT,
-		UPDATE3_EVENT,
-		UPDATE4_EVENT,
-		UPDATE5_EVENT,
-		UPDATE6_EVENT,
-		UPDATE7_EVENT,
-		UPDATE8_EVENT,
-		UPDATE12_EVENT,
-		UPDATE14_EVENT,
     	TOUCH_DOWN_EVENT,
-		TOUCH_UP_EVENT,
+		TOUCH_UP_EVENT,		// a tap, touchXY is the raw pen position
+		TOUCH_MOVE_EVENT,	// vector: px the pen was dragged by, summed up
+		LONG_PRESS_EVENT,	// vector: where, px; no tap follows on release
+		SWIPE_LEFT_EVENT,	// vector: px/s at release
+		SWIPE_RIGHT_EVENT,
+		SWIPE_UP_EVENT,
+		SWIPE_DOWN_EVENT,
+		FLING_EVENT,		// vector: px/s at release
 		SDCARD_INSERT,
 		SDCARD_REMOVE,
 		USBDRIVE_INSERT,
@@ -71,17 +68,26 @@ typedef struct
     } ucEventID;
     union {
     	unsigned int touchXY;
+    	struct {
+    		int16_t x;
+    		int16_t y;
+    	} vector;
     } ucData;
 } xUIEvent_t;
 
 extern QueueHandle_t xUIEventQueue;
 
+/* the printer port (USART2) has one transmitter at a time, any task may call it */
+HAL_StatusTypeDef comm1Transmit(const uint8_t *pData, uint16_t size);
+
 #define MAXSTATSIZE 320/8
 extern uint8_t statString[MAXSTATSIZE+1];
 
 typedef void (*volatile eventProcessor_t) (xUIEvent_t *);
 extern eventProcessor_t processEvent;
 
+void uiPrefetch(void);		// prefetch task, see ui_icon.h
+
 typedef enum {
 	MOVE_01 = 0,
 	MOVE_1,
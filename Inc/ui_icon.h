@@ -0,0 +1,156 @@
+/**
+  ******************************************************************************
+  * File Name          : ui_icon.h
+  * Description        : This file contains icon file and icon pack definitions
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __UI_ICON_H
+#define __UI_ICON_H
+
+#include "stm32f1xx_hal.h"
+#include "lcd.h"
+
+/*
+ * icon files: raw RGB565 rows, or an indexed icon (tools/iconpal.py) made of
+ * this header, the RGB565 palette (colors entries) and the pixel indices,
+ * 8 or 4 bits per pixel, high nibble first, rows not padded.
+ * With ICON_RLE the indices are run-length coded, decoded in one pass:
+ *	0x00..0x7f, n		literal of n + 1 pixels, packed as above
+ *	0x80..0xff, index	run of (n & 0x7f) + 2 pixels
+ * */
+
+#define ICON_MAGIC	"MKSI"
+#define ICON_RLE	0x01	// xIconHeader_t flags
+
+typedef struct {
+	char magic[4];
+	uint8_t bpp;			// 8 or 4
+	uint8_t flags;			// ICON_RLE
+	uint16_t width;
+	uint16_t height;
+	uint16_t colors;
+} xIconHeader_t;
+
+/*
+ * icon pack (tools/iconpak.py): all icons in one file, opened once at boot.
+ * The header is followed by the entry table sorted by name hash, every entry
+ * points to a sector aligned icon file image (raw or indexed) in the pack.
+ * Icons are looked up by uiIconHash() of the lower case file name.
+ * */
+
+#define ICON_PACK_PATH	"0:/mks_pic.pak"
+#define ICON_PACK_MAGIC	"MKSP"
+#define ICON_PACK_CLMT	32			// fast seek cluster map, DWORDs
+
+typedef enum {
+	ICON_RAW = 0,
+	ICON_INDEXED
+} xIconFormat_t;
+
+typedef struct {
+	char magic[4];
+	uint16_t count;
+	uint16_t reserved;
+} xIconPackHeader_t;
+
+typedef struct {
+	uint32_t hash;
+	uint32_t offset;
+	uint32_t size;
+	uint16_t width;
+	uint16_t height;
+	uint8_t format;
+	uint8_t reserved[3];
+} xIconPackEntry_t;
+
+uint32_t uiIconHash(const char *name);
+void uiIconPackOpen(void);
+void uiIconPackClose(void);
+int uiIconFind(uint32_t hash);
+void uiDrawPackIcon(int index, uint16_t x, uint16_t y);
+
+/* cache, pack, then the file under path if the pack has no such icon */
+void uiDrawBinIcon(const char *path, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height);
+
+/*
+ * icon cache: uiDrawBinIcon() keeps the icon file images it has read in
+ * FreeRTOS heap, up to ICON_CACHE_SIZE bytes, keyed by uiIconHash() of the
+ * path; the least recently drawn icons are dropped first. A hit is streamed
+ * from RAM without touching the flash.
+ *
+ * The budget is sized for tools/iconpal.py assets: a 78x104 icon is at most
+ * ~4 KB in 4 bpp and less when run-length coded. Raw RGB565 icons (16224
+ * bytes) and 8 bpp ones with more than ~34 colors never fit and are not
+ * cached, see xIconCacheStats_t.tooLarge; the 40 KB heap also holds the UI
+ * task stack, so the budget can't grow to hold raw icons
+ * */
+
+#define ICON_CACHE_SIZE	(8 * 1024)	// bytes, 0 - no cache
+
+#if ICON_CACHE_SIZE
+typedef struct {
+	uint32_t hits;
+	uint32_t misses;
+	uint32_t bytesSaved;	// not read from the flash thanks to hits
+	uint32_t bytes;			// cached now
+	uint16_t icons;
+	uint16_t prefetched;	// icons read ahead by uiIconPrefetch()
+	uint32_t tooLarge;		// different icons bigger than the whole budget
+} xIconCacheStats_t;
+
+void uiIconCacheStats(xIconCacheStats_t *pStats);
+void uiIconCacheFlush(void);
+
+/*
+ * prefetch task: reads an icon into the cache if it fits the free part of
+ * the budget; 0 - stop, the cache is full or the UI task wants the lock.
+ * Icons known to be too large are skipped without opening their files
+ * */
+uint8_t uiIconPrefetch(const char *path, uint16_t width, uint16_t height);
+#endif /* ICON_CACHE_SIZE */
+
+/* icons (and FatFs) are used by the UI and the prefetch task, one at a time */
+void uiIconLockInit(void);
+void uiIconLock(void);
+void uiIconUnlock(void);
+
+#if LCD_BENCHMARK
+typedef struct {
+	uint32_t fileTicks;		// icons drawn from their files, ms
+	uint32_t packTicks;		// same icons from the pack, ms
+} xIconBenchmark_t;
+
+void uiIconBenchmark(const char *const *paths, uint8_t count,
+		xIconBenchmark_t *result);
+#endif /* LCD_BENCHMARK */
+
+#endif /* __UI_ICON_H */
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * File Name          : ui_widget.h
+  * Description        : This file contains retained mode widget definitions
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __UI_WIDGET_H
+#define __UI_WIDGET_H
+
+#include "stm32f1xx_hal.h"
+#include "lcd.h"
+
+#define WIDGET_MAX		12		// widgets per screen
+#define WIDGET_TEXTLEN	(320 / 8)
+#define WIDGET_DIRTYMAX	8		// merged background rectangles per redraw
+
+typedef enum {
+	WIDGET_ICON = 0,
+	WIDGET_LABEL,
+	WIDGET_NUMBER,
+	WIDGET_PROGRESS
+} xWidgetType_t;
+
+/*
+ * a widget keeps what it should show and a fingerprint of what is on the
+ * screen; uiWidgetRedraw() draws only widgets where the two differ
+ * */
+
+typedef struct {
+	uint8_t		type;
+	uint8_t		dirty;			// on-screen state unknown, full redraw
+	uint16_t	x, y, width, height;
+	uint16_t	color, bgcolor;
+
+	const char	*icon;			// WIDGET_ICON: .bin path, NULL - empty
+	const font_t *font;			// WIDGET_NUMBER: NULL - 8x16 cp866
+	char		text[WIDGET_TEXTLEN + 1];	// WIDGET_LABEL
+	int32_t		value;			// WIDGET_NUMBER, WIDGET_PROGRESS
+	uint32_t	scale;			// WIDGET_PROGRESS
+
+	uint32_t	shown;			// fingerprint of the drawn content
+} xWidget_t;
+
+/*
+ * screens are described between uiWidgetBegin() and uiWidgetEnd(); widgets
+ * of the same type and geometry as on the previous screen keep their pixels
+ * */
+
+void uiWidgetBegin(uint16_t bgcolor);
+xWidget_t *uiWidgetIcon(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		const char *path);
+xWidget_t *uiWidgetLabel(uint16_t x, uint16_t y, uint16_t width, uint8_t height,
+		const char *text, uint16_t color);
+xWidget_t *uiWidgetNumber(uint16_t x, uint16_t y, uint16_t width, const font_t *font,
+		int32_t value, uint16_t color);
+xWidget_t *uiWidgetProgress(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint32_t scale, uint16_t color);
+void uiWidgetEnd(void);
+
+void uiWidgetSetIcon(xWidget_t *widget, const char *path);
+void uiWidgetSetText(xWidget_t *widget, const char *text);
+void uiWidgetSetValue(xWidget_t *widget, int32_t value);
+
+void uiWidgetInvalidate(void);
+void uiWidgetRedraw(void);
+
+uint32_t uiHash(const char *text);
+
+#endif /* __UI_WIDGET_H */
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -31,6 +31,10 @@
   ******************************************************************************
   */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "fatfs.h"
 #include "mxconstants.h"
 
@@ -96,6 +100,222 @@ FRESULT transferFile(const TCHAR *source, const TCHAR *dest, uint8_t overwrite)
 	return res;
 }
 
+/*
+ * CRC-32 (IEEE 802.3, as zlib), nibble table; start with crc = 0 and pass
+ * the result back in to continue over the next block
+ * */
+
+uint32_t updateCRC32(uint32_t crc, const void *data, size_t size) {
+
+	static const uint32_t table[16] = {
+		0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac,
+		0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+		0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+		0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+	};
+	const uint8_t *p = data;
+
+	crc = ~crc;
+	while (size--) {
+		crc ^= *p++;
+		crc = (crc >> 4) ^ table[crc & 0x0f];
+		crc = (crc >> 4) ^ table[crc & 0x0f];
+	}
+
+	return ~crc;
+}
+
+/*
+ * CRC-32 and size of a file
+ * */
+
+FRESULT crcFile(const TCHAR *path, uint32_t *pSize, uint32_t *pCrc) {
+
+	FIL		*pFile = NULL;
+	BYTE	*pBuffer = NULL;
+
+	FRESULT res = FR_OK;
+
+	*pSize = 0;
+	*pCrc = 0;
+
+	if (NULL != (pFile = pvPortMalloc(sizeof(FIL))) &&
+			NULL != (pBuffer = pvPortMalloc(_MIN_SS))) {
+
+		if (FR_OK == (res = f_open(pFile, path, FA_READ))) {
+
+			size_t bytes;
+
+			while (FR_OK == (res = f_read(pFile, pBuffer, _MIN_SS, &bytes)) && bytes) {
+				*pCrc = updateCRC32(*pCrc, pBuffer, bytes);
+				*pSize += bytes;
+			}
+
+			f_close(pFile);
+		}
+
+	} else {
+		res = FR_NOT_ENOUGH_CORE;
+	}
+
+	if (pBuffer) vPortFree(pBuffer);
+	if (pFile) vPortFree(pFile);
+
+	return res;
+}
+
+/*
+ * incremental copy with a manifest of "CRC size path" lines. A line is
+ * appended to the manifest only after the copy has been read back, and a
+ * "-------- - path" line before the copy starts, so the last line of a path
+ * always tells the truth, whenever the power goes. A file is copied when
+ * its last line doesn't match the source, or the copy has another size.
+ * Every file checked or copied is also listed in a fresh manifest, which
+ * replaces the old one when the whole sync went well
+ * */
+
+static uint8_t syncLookup(sync_t *pSync, const TCHAR *dest, uint32_t size, uint32_t crc) {
+
+	TCHAR line[SYNC_LINE];
+	uint8_t match = 0;
+
+	if (f_lseek(pSync->pManifest, 0) != FR_OK)
+		return 0;
+
+	while (f_gets(line, sizeof(line), pSync->pManifest)) {
+
+		char *pEnd = line;
+		uint32_t lineCrc = strtoul(line, &pEnd, 16);
+		uint8_t valid = (pEnd == line + 8);
+		uint32_t lineSize = strtoul(pEnd, &pEnd, 10);
+		char *pPath = strchr(line + 8, ' ');
+
+		if (pPath && (pPath = strchr(pPath + 1, ' ')) != NULL) {
+			pPath[strcspn(pPath, "\r\n")] = '\0';
+			if (strcmp(pPath + 1, dest) == 0)
+				match = valid && lineCrc == crc && lineSize == size;
+		}
+	}
+
+	return match;
+}
+
+static FRESULT syncLine(FIL *pFile, const TCHAR *dest, uint32_t size, uint32_t crc,
+		uint8_t valid) {
+
+	int written;
+
+	if (valid)
+		written = f_printf(pFile, "%08lX %lu %s\n", crc, size, dest);
+	else
+		written = f_printf(pFile, "-------- - %s\n", dest);
+
+	return (written < 0) ? FR_DISK_ERR : f_sync(pFile);
+}
+
+FRESULT beginSync(sync_t *pSync, const TCHAR *manifest) {
+
+	FILINFO fno;
+	FRESULT res;
+
+	memset(pSync, 0, sizeof(*pSync));
+	snprintf(pSync->next, sizeof(pSync->next), "%s~", manifest);
+
+	// the power went between the two steps of endSync()
+	if (f_stat(manifest, &fno) == FR_NO_FILE)
+		f_rename(pSync->next, manifest);
+
+	if (NULL == (pSync->pManifest = pvPortMalloc(sizeof(FIL))) ||
+			NULL == (pSync->pNext = pvPortMalloc(sizeof(FIL)))) {
+		endSync(pSync);
+		return FR_NOT_ENOUGH_CORE;
+	}
+
+	if (FR_OK == (res = f_open(pSync->pManifest, manifest,
+			FA_READ | FA_WRITE | FA_OPEN_ALWAYS))) {
+		if (FR_OK == (res = f_open(pSync->pNext, pSync->next,
+				FA_WRITE | FA_CREATE_ALWAYS))) {
+			pSync->manifest = manifest;
+			return FR_OK;
+		}
+		f_close(pSync->pManifest);
+	}
+
+	vPortFree(pSync->pNext);
+	vPortFree(pSync->pManifest);
+	pSync->pNext = pSync->pManifest = NULL;
+
+	return res;
+}
+
+/* *pCopied tells whether the file had to be copied */
+
+FRESULT syncFile(sync_t *pSync, const TCHAR *source, const TCHAR *dest, uint8_t *pCopied) {
+
+	FILINFO fno;
+	uint32_t size, crc, destSize, destCrc;
+	FRESULT res;
+
+	*pCopied = 0;
+
+	if (!pSync->manifest)
+		res = FR_INVALID_OBJECT;
+	else if (strlen(dest) + 20 >= SYNC_LINE)
+		res = FR_INVALID_NAME;
+	else if (FR_OK == (res = crcFile(source, &size, &crc))) {
+
+		if (!syncLookup(pSync, dest, size, crc)
+				|| f_stat(dest, &fno) != FR_OK || fno.fsize != size) {
+
+			*pCopied = 1;
+
+			if (FR_OK == (res = syncLine(pSync->pManifest, dest, 0, 0, 0))
+					&& FR_OK == (res = transferFile(source, dest, 1))
+					&& FR_OK == (res = crcFile(dest, &destSize, &destCrc))) {
+				if (destSize != size || destCrc != crc)
+					res = FR_DISK_ERR;
+				else
+					res = syncLine(pSync->pManifest, dest, size, crc, 1);
+			}
+		}
+
+		if (FR_OK == res)
+			res = syncLine(pSync->pNext, dest, size, crc, 1);
+	}
+
+	if (FR_OK != res)
+		pSync->failed++;
+	else if (*pCopied)
+		pSync->copied++;
+
+	return res;
+}
+
+/* FR_OK if every file is in place, the manifest is compacted then */
+
+FRESULT endSync(sync_t *pSync) {
+
+	FRESULT res = pSync->failed ? FR_DISK_ERR : FR_OK;
+
+	if (pSync->manifest) {
+		f_close(pSync->pManifest);
+		f_close(pSync->pNext);
+
+		if (FR_OK == res && FR_OK == (res = f_unlink(pSync->manifest)))
+			res = f_rename(pSync->next, pSync->manifest);
+		else
+			f_unlink(pSync->next);
+	}
+
+	if (pSync->pNext) vPortFree(pSync->pNext);
+	if (pSync->pManifest) vPortFree(pSync->pManifest);
+
+	pSync->pNext = pSync->pManifest = NULL;
+	pSync->manifest = NULL;
+
+	return res;
+}
+
 /* USER CODE BEGIN Variables */
 
 /* USER CODE END Variables */    
@@ -0,0 +1,924 @@
+/**
+  ******************************************************************************
+  * File Name          : fonts.c
+  * Description        : This file contains generated font tables
+  *                      generated by tools/fontgen.py, do not edit
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include "fonts.h"
+
+
+static const uint8_t font_prop16_data[5444] = {
+	0x08, 0x81, 0x00, 0x8b, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x05, 0x81, 0x01, 0x81, 0x10, 0x05,
+	0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x00, 0x80, 0x01, 0x80, 0x42, 0x15, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x00, 0x86, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x00, 0x86, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x1c, 0x02, 0x81, 0x04,
+	0x81, 0x02, 0x84, 0x00, 0x81, 0x02, 0x83, 0x03, 0x82, 0x05, 0x84, 0x05, 0x81, 0x04, 0x82, 0x03,
+	0x83, 0x02, 0x81, 0x00, 0x84, 0x03, 0x81, 0x04, 0x81, 0x0f, 0x1b, 0x81, 0x03, 0x82, 0x02, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x82, 0x03, 0x81, 0x1b, 0x0f,
+	0x82, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x02, 0x82, 0x02, 0x82, 0x00, 0x83, 0x00,
+	0x82, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x82, 0x00,
+	0x81, 0x1b, 0x03, 0x81, 0x00, 0x81, 0x00, 0x83, 0x21, 0x09, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x02, 0x81, 0x02, 0x81, 0x0f, 0x07, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x11, 0x28, 0x81, 0x01, 0x81, 0x02, 0x83, 0x01, 0x87, 0x01, 0x83, 0x02, 0x81, 0x01,
+	0x81, 0x30, 0x1f, 0x81, 0x03, 0x81, 0x01, 0x85, 0x01, 0x81, 0x03, 0x81, 0x25, 0x1b, 0x81, 0x00,
+	0x81, 0x00, 0x83, 0x09, 0x30, 0x86, 0x37, 0x13, 0x83, 0x07, 0x21, 0x80, 0x04, 0x81, 0x03, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x80, 0x21, 0x0f, 0x82, 0x02, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83, 0x02,
+	0x83, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x82, 0x1d, 0x0d, 0x81, 0x02, 0x82, 0x01, 0x83,
+	0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x01, 0x85, 0x17, 0x0e,
+	0x84, 0x00, 0x81, 0x02, 0x81, 0x04, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03,
+	0x81, 0x04, 0x81, 0x02, 0x88, 0x1b, 0x0e, 0x84, 0x00, 0x81, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81,
+	0x01, 0x83, 0x05, 0x81, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x11, 0x81, 0x03,
+	0x82, 0x02, 0x83, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x86, 0x03, 0x81, 0x04,
+	0x81, 0x04, 0x81, 0x03, 0x83, 0x1b, 0x0d, 0x88, 0x04, 0x81, 0x04, 0x81, 0x04, 0x85, 0x05, 0x81,
+	0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0f, 0x82, 0x02, 0x81, 0x03, 0x81, 0x04,
+	0x81, 0x04, 0x85, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c,
+	0x0d, 0x88, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x81,
+	0x04, 0x81, 0x04, 0x81, 0x1e, 0x0e, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00,
+	0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0e, 0x84,
+	0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x85, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81,
+	0x03, 0x81, 0x01, 0x83, 0x1d, 0x07, 0x83, 0x05, 0x83, 0x09, 0x0c, 0x81, 0x00, 0x81, 0x09, 0x81,
+	0x00, 0x83, 0x0c, 0x15, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x04, 0x81, 0x04,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x17, 0x1d, 0x85, 0x0b, 0x85, 0x29, 0x11, 0x81, 0x04, 0x81, 0x04,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x1b, 0x0e, 0x84,
+	0x00, 0x81, 0x02, 0x83, 0x02, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x81, 0x04, 0x81, 0x0b, 0x81,
+	0x04, 0x81, 0x1d, 0x15, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x00, 0x85, 0x00, 0x85, 0x00,
+	0x85, 0x00, 0x82, 0x00, 0x81, 0x05, 0x84, 0x1c, 0x10, 0x80, 0x04, 0x82, 0x02, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x02, 0x83, 0x02, 0x8a, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0d,
+	0x85, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x84, 0x01,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x87, 0x1c,
+	0x0f, 0x83, 0x01, 0x81, 0x01, 0x83, 0x03, 0x82, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81,
+	0x03, 0x80, 0x00, 0x81, 0x01, 0x81, 0x01, 0x83, 0x1c, 0x0d, 0x84, 0x02, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x84, 0x1d, 0x0d, 0x86,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x00, 0x80, 0x02, 0x83, 0x02, 0x81,
+	0x00, 0x80, 0x02, 0x81, 0x04, 0x81, 0x02, 0x80, 0x00, 0x81, 0x01, 0x88, 0x1b, 0x0d, 0x86, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x00, 0x80, 0x02, 0x83, 0x02, 0x81, 0x00,
+	0x80, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x83, 0x1e, 0x0f, 0x83, 0x01, 0x81, 0x01, 0x83,
+	0x03, 0x82, 0x04, 0x81, 0x04, 0x81, 0x00, 0x85, 0x02, 0x83, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x01, 0x82, 0x00, 0x80, 0x1b, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x8a, 0x02,
+	0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x07, 0x83, 0x00, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x83, 0x0f, 0x10,
+	0x83, 0x03, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x83, 0x1d, 0x0d, 0x82, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x83, 0x02, 0x83, 0x02, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x84, 0x01, 0x81, 0x1b, 0x0d, 0x83, 0x03,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x02, 0x80, 0x00,
+	0x81, 0x01, 0x88, 0x1b, 0x0d, 0x81, 0x02, 0x84, 0x00, 0x92, 0x00, 0x80, 0x00, 0x83, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0d, 0x81, 0x02, 0x84, 0x01, 0x85, 0x00,
+	0x8a, 0x00, 0x85, 0x01, 0x84, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0e, 0x84,
+	0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83,
+	0x02, 0x81, 0x00, 0x84, 0x1c, 0x0d, 0x85, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x83, 0x1e,
+	0x0e, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83,
+	0x00, 0x80, 0x00, 0x83, 0x00, 0x83, 0x00, 0x84, 0x04, 0x81, 0x04, 0x82, 0x0d, 0x0d, 0x85, 0x01,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x84, 0x01, 0x81, 0x1b,
+	0x0e, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x81, 0x00, 0x81, 0x05, 0x82, 0x05, 0x81, 0x05, 0x83,
+	0x02, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0b, 0x8c, 0x00, 0x81, 0x00, 0x80, 0x01, 0x81, 0x03,
+	0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x83, 0x18, 0x0d, 0x81, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81,
+	0x00, 0x84, 0x1c, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x82, 0x04, 0x80, 0x1e, 0x0d, 0x81, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80,
+	0x00, 0x8b, 0x00, 0x82, 0x00, 0x81, 0x00, 0x81, 0x1c, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x01, 0x84, 0x02, 0x82, 0x03, 0x82, 0x02, 0x84, 0x01, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0b, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81,
+	0x00, 0x83, 0x02, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x83, 0x18, 0x0d, 0x88, 0x02,
+	0x82, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x82, 0x02,
+	0x88, 0x1b, 0x07, 0x85, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x83, 0x0f, 0x14, 0x80, 0x05, 0x81, 0x04, 0x82, 0x04, 0x82, 0x04, 0x82, 0x04,
+	0x82, 0x04, 0x82, 0x04, 0x81, 0x05, 0x80, 0x1b, 0x07, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x85, 0x0f, 0x02, 0x80, 0x04, 0x82, 0x02,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x81, 0x53, 0x67, 0x87, 0x0f, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x26, 0x23, 0x83, 0x05, 0x81, 0x01, 0x84, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x01, 0x82, 0x00, 0x81, 0x1b, 0x0d, 0x82, 0x04, 0x81, 0x04, 0x81, 0x04, 0x83,
+	0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x84, 0x1c, 0x23, 0x84, 0x00, 0x81, 0x02, 0x83, 0x04, 0x81, 0x04,
+	0x81, 0x04, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x10, 0x82, 0x04, 0x81, 0x04, 0x81, 0x02, 0x83,
+	0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x01, 0x82, 0x00, 0x81, 0x1b, 0x23, 0x84, 0x00, 0x81, 0x02, 0x8a, 0x04,
+	0x81, 0x04, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0d, 0x82, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x01, 0x80, 0x00, 0x81, 0x02, 0x83, 0x02, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x83,
+	0x19, 0x23, 0x82, 0x00, 0x83, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x01, 0x84, 0x04, 0x81, 0x04, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x83, 0x08,
+	0x0d, 0x82, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x00, 0x81, 0x01, 0x82, 0x00, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x84, 0x01, 0x81,
+	0x1b, 0x08, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01,
+	0x81, 0x00, 0x83, 0x0f, 0x0f, 0x81, 0x03, 0x81, 0x08, 0x82, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x03, 0x83, 0x01, 0x83, 0x01, 0x81, 0x00, 0x83, 0x06, 0x0d, 0x82, 0x04,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x83, 0x02, 0x83, 0x02,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x84, 0x01, 0x81, 0x1b, 0x07, 0x82, 0x01, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x83, 0x0f, 0x22,
+	0x82, 0x00, 0x81, 0x00, 0x88, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00,
+	0x83, 0x00, 0x80, 0x00, 0x83, 0x02, 0x81, 0x1b, 0x22, 0x81, 0x00, 0x82, 0x01, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x1b, 0x23, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x22, 0x81, 0x00, 0x82, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x84,
+	0x01, 0x81, 0x04, 0x81, 0x03, 0x83, 0x09, 0x23, 0x82, 0x00, 0x83, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x84, 0x04,
+	0x81, 0x04, 0x81, 0x03, 0x83, 0x06, 0x22, 0x81, 0x00, 0x82, 0x01, 0x82, 0x00, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x83, 0x1e, 0x23, 0x84, 0x00, 0x81, 0x02,
+	0x81, 0x00, 0x81, 0x05, 0x82, 0x05, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x10, 0x80,
+	0x04, 0x81, 0x04, 0x81, 0x02, 0x85, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81,
+	0x00, 0x81, 0x02, 0x82, 0x1c, 0x22, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x82, 0x00,
+	0x81, 0x1b, 0x1d, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x00, 0x83,
+	0x02, 0x81, 0x19, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00,
+	0x83, 0x00, 0x80, 0x00, 0x88, 0x00, 0x81, 0x00, 0x81, 0x1c, 0x22, 0x81, 0x02, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x02, 0x82, 0x03, 0x82, 0x03, 0x82, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x1b, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x85, 0x04,
+	0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x07, 0x22, 0x88, 0x01, 0x81, 0x03, 0x81, 0x03, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x02, 0x88, 0x1b, 0x0e, 0x82, 0x01, 0x81, 0x03, 0x81, 0x03, 0x81, 0x01,
+	0x82, 0x04, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x82, 0x17, 0x03, 0x87, 0x01, 0x89,
+	0x07, 0x0b, 0x82, 0x04, 0x81, 0x03, 0x81, 0x03, 0x81, 0x04, 0x82, 0x01, 0x81, 0x03, 0x81, 0x03,
+	0x81, 0x03, 0x81, 0x01, 0x82, 0x1a, 0x0e, 0x82, 0x00, 0x83, 0x00, 0x82, 0x54, 0x1e, 0x80, 0x04,
+	0x82, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x88, 0x22, 0x10, 0x83,
+	0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x83, 0x02, 0x83, 0x02, 0x8a, 0x02, 0x83, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x81, 0x1b, 0x0d, 0x86, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x80, 0x00,
+	0x81, 0x04, 0x84, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x87, 0x1c, 0x0d, 0x85, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x87, 0x1c, 0x0d, 0x86, 0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x02, 0x80, 0x00,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x83, 0x1e, 0x12, 0x83,
+	0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x00, 0x89, 0x03, 0x83, 0x03, 0x81, 0x0f, 0x0d, 0x86, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x02,
+	0x80, 0x00, 0x81, 0x00, 0x80, 0x02, 0x83, 0x02, 0x81, 0x00, 0x80, 0x02, 0x81, 0x04, 0x81, 0x02,
+	0x80, 0x00, 0x81, 0x01, 0x88, 0x1b, 0x0d, 0x81, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x81,
+	0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x84, 0x01, 0x84,
+	0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83,
+	0x00, 0x80, 0x00, 0x81, 0x1b, 0x0e, 0x84, 0x00, 0x81, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x01,
+	0x83, 0x05, 0x81, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0d, 0x81, 0x02, 0x83,
+	0x02, 0x83, 0x01, 0x84, 0x01, 0x84, 0x00, 0x80, 0x00, 0x84, 0x01, 0x84, 0x01, 0x83, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x81, 0x1b, 0x01, 0x82, 0x03, 0x82, 0x01, 0x81, 0x02, 0x83, 0x02, 0x83, 0x01,
+	0x84, 0x01, 0x84, 0x00, 0x80, 0x00, 0x84, 0x01, 0x84, 0x01, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x81, 0x1b, 0x0d, 0x82, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x01, 0x84, 0x01, 0x81, 0x1b, 0x10, 0x83, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01, 0x83, 0x02,
+	0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0d, 0x81,
+	0x02, 0x84, 0x00, 0x92, 0x00, 0x80, 0x00, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83,
+	0x02, 0x81, 0x1b, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x8a, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0e, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83,
+	0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0d,
+	0x88, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x81, 0x1b, 0x0d, 0x85, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x83, 0x1e, 0x0f,
+	0x83, 0x01, 0x81, 0x01, 0x83, 0x03, 0x82, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03,
+	0x80, 0x00, 0x81, 0x01, 0x81, 0x01, 0x83, 0x1c, 0x0b, 0x86, 0x00, 0x81, 0x00, 0x80, 0x01, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x83, 0x18, 0x0d,
+	0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x85, 0x04, 0x81, 0x04,
+	0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x09, 0x83, 0x04, 0x81, 0x03, 0x85, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x85, 0x03, 0x81, 0x04, 0x83, 0x21, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x01, 0x84, 0x02, 0x82, 0x03, 0x82, 0x02, 0x84, 0x01, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x0d, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x86, 0x04, 0x81, 0x04, 0x81,
+	0x0d, 0x0d, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x85, 0x04,
+	0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x1b, 0x0f, 0x81, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x89, 0x1f, 0x0f,
+	0x81, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00,
+	0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00,
+	0x83, 0x00, 0x81, 0x00, 0x89, 0x05, 0x81, 0x05, 0x81, 0x0f, 0x0d, 0x84, 0x01, 0x80, 0x00, 0x81,
+	0x04, 0x81, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x00, 0x84, 0x1c, 0x0f, 0x81, 0x03, 0x83, 0x03, 0x83, 0x03,
+	0x83, 0x03, 0x85, 0x01, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00,
+	0x83, 0x00, 0x81, 0x00, 0x85, 0x01, 0x81, 0x1f, 0x0d, 0x83, 0x03, 0x81, 0x04, 0x81, 0x04, 0x81,
+	0x04, 0x84, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x87, 0x1c, 0x0e, 0x84, 0x00, 0x81, 0x02, 0x81, 0x04, 0x81, 0x01, 0x80, 0x01, 0x81, 0x01,
+	0x84, 0x01, 0x80, 0x01, 0x81, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0f, 0x81,
+	0x01, 0x82, 0x00, 0x81, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x86,
+	0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x83, 0x01, 0x82, 0x20, 0x11, 0x85, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01,
+	0x81, 0x01, 0x81, 0x02, 0x84, 0x02, 0x84, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01,
+	0x81, 0x01, 0x81, 0x00, 0x82, 0x01, 0x82, 0x1f, 0x23, 0x83, 0x05, 0x81, 0x01, 0x84, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x82, 0x00, 0x81, 0x1b, 0x0a,
+	0x80, 0x03, 0x81, 0x00, 0x83, 0x00, 0x81, 0x03, 0x81, 0x03, 0x84, 0x00, 0x81, 0x01, 0x83, 0x01,
+	0x83, 0x01, 0x83, 0x01, 0x81, 0x00, 0x83, 0x18, 0x22, 0x85, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x84, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x87, 0x1c, 0x1d, 0x85, 0x00,
+	0x81, 0x01, 0x80, 0x00, 0x81, 0x01, 0x80, 0x00, 0x81, 0x03, 0x81, 0x03, 0x81, 0x02, 0x83, 0x19,
+	0x2a, 0x83, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x89, 0x03, 0x83, 0x03, 0x81, 0x0f, 0x23, 0x84, 0x00,
+	0x81, 0x02, 0x8a, 0x04, 0x81, 0x04, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x22, 0x81, 0x00, 0x80,
+	0x00, 0x83, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x84, 0x01, 0x80,
+	0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x81, 0x1b, 0x1e,
+	0x83, 0x00, 0x81, 0x01, 0x81, 0x03, 0x81, 0x02, 0x81, 0x04, 0x83, 0x01, 0x81, 0x00, 0x83, 0x18,
+	0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x01, 0x84, 0x00, 0x80, 0x00, 0x84, 0x01, 0x83, 0x02, 0x83,
+	0x02, 0x81, 0x1b, 0x16, 0x82, 0x03, 0x82, 0x01, 0x81, 0x02, 0x83, 0x02, 0x83, 0x01, 0x84, 0x00,
+	0x80, 0x00, 0x84, 0x01, 0x83, 0x02, 0x83, 0x02, 0x81, 0x1b, 0x22, 0x82, 0x01, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x01, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x81, 0x01, 0x81, 0x01, 0x84, 0x01, 0x81,
+	0x1b, 0x1f, 0x83, 0x00, 0x81, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,
+	0x81, 0x17, 0x22, 0x81, 0x02, 0x84, 0x00, 0x92, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83,
+	0x02, 0x81, 0x1b, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x8a, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x81, 0x1b, 0x23, 0x84, 0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81,
+	0x00, 0x84, 0x1c, 0x22, 0x88, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x81, 0x1b, 0x01, 0x80, 0x02, 0x81, 0x02, 0x80, 0x03, 0x80, 0x02, 0x81, 0x02, 0x80, 0x03, 0x80,
+	0x02, 0x81, 0x02, 0x80, 0x03, 0x80, 0x02, 0x81, 0x02, 0x80, 0x03, 0x80, 0x02, 0x81, 0x02, 0x80,
+	0x03, 0x80, 0x02, 0x81, 0x02, 0x80, 0x03, 0x80, 0x02, 0x81, 0x02, 0x80, 0x03, 0x80, 0x02, 0x81,
+	0x02, 0x80, 0x01, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00,
+	0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01,
+	0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00,
+	0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00,
+	0x80, 0x00, 0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00,
+	0x81, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00,
+	0x80, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x80, 0x00,
+	0x80, 0x00, 0x80, 0x00, 0x81, 0x00, 0x82, 0x00, 0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00,
+	0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00, 0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00,
+	0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00, 0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00,
+	0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00, 0x80, 0x00, 0x82, 0x00, 0x84, 0x00, 0x82, 0x00,
+	0x80, 0x00, 0x82, 0x00, 0x82, 0x9f, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x86, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x86, 0x02, 0x86,
+	0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x30, 0x86,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x18, 0x84, 0x02, 0x86, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x00, 0x81, 0x04, 0x85, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x81, 0x00,
+	0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00,
+	0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x83, 0x00, 0x81, 0x22,
+	0x86, 0x04, 0x85, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00,
+	0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x00, 0x81, 0x04, 0x88, 0x37, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x88, 0x37, 0x02, 0x81, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x86, 0x02, 0x86, 0x27, 0x22, 0x84, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x84, 0x27, 0x02, 0x81, 0x05, 0x81, 0x05, 0x81,
+	0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x87, 0x3f, 0x37, 0x87, 0x02, 0x81, 0x05,
+	0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x86, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x37, 0x87, 0x3f, 0x02,
+	0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x87, 0x02,
+	0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x86, 0x02, 0x86, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x84, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x84, 0x03, 0x85, 0x2f, 0x1d, 0x87, 0x03, 0x81, 0x00, 0x84, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00,
+	0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x83, 0x00,
+	0x82, 0x07, 0x87, 0x3f, 0x27, 0x87, 0x07, 0x83, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x84, 0x03, 0x81, 0x00, 0x84, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x27, 0x87, 0x07, 0x87, 0x3f, 0x01, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x83,
+	0x00, 0x82, 0x07, 0x83, 0x00, 0x82, 0x01, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x02, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05,
+	0x81, 0x02, 0x87, 0x07, 0x87, 0x3f, 0x01, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81,
+	0x00, 0x81, 0x00, 0x87, 0x3f, 0x27, 0x87, 0x07, 0x87, 0x02, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05,
+	0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x37, 0x87, 0x01, 0x81, 0x00, 0x81,
+	0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81,
+	0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x85, 0x2f, 0x81, 0x02, 0x81, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x02, 0x86, 0x02, 0x84, 0x27, 0x18, 0x86, 0x02, 0x86, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x29, 0x87, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81,
+	0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x81, 0x00, 0x01, 0x81, 0x00,
+	0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00,
+	0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x87, 0x01, 0x81, 0x00, 0x81, 0x02,
+	0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02,
+	0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x02, 0x81, 0x05, 0x81,
+	0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x87, 0x02, 0x81, 0x02, 0x87, 0x02, 0x81, 0x05, 0x81,
+	0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x02, 0x02, 0x81, 0x02,
+	0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x86, 0x27, 0x22, 0x86, 0x02, 0x81,
+	0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0xff, 0x37, 0xc7,
+	0xbf, 0xbf, 0xb7, 0x47, 0x22, 0x81, 0x00, 0x82, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x84, 0x01, 0x81,
+	0x04, 0x81, 0x03, 0x83, 0x09, 0x23, 0x84, 0x00, 0x81, 0x02, 0x83, 0x04, 0x81, 0x04, 0x81, 0x04,
+	0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x1d, 0x86, 0x00, 0x81, 0x00, 0x80, 0x01, 0x81, 0x03, 0x81,
+	0x03, 0x81, 0x03, 0x81, 0x02, 0x83, 0x18, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x81, 0x00, 0x85, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x07, 0x21, 0x83,
+	0x04, 0x81, 0x03, 0x85, 0x00, 0x81, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x83, 0x00, 0x81, 0x00, 0x81, 0x00, 0x85, 0x03, 0x81, 0x05, 0x81, 0x04, 0x83, 0x09, 0x22,
+	0x81, 0x02, 0x81, 0x00, 0x81, 0x00, 0x81, 0x02, 0x82, 0x03, 0x82, 0x03, 0x82, 0x02, 0x81, 0x00,
+	0x81, 0x00, 0x81, 0x02, 0x81, 0x1b, 0x22, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x86,
+	0x04, 0x81, 0x04, 0x81, 0x0d, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00,
+	0x85, 0x04, 0x81, 0x04, 0x81, 0x1b, 0x22, 0x81, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83,
+	0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x83, 0x00, 0x80, 0x00, 0x88,
+	0x1b, 0x27, 0x81, 0x00, 0x80, 0x00, 0x81, 0x00, 0x81, 0x00, 0x80, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x80, 0x00, 0x81, 0x00, 0x81, 0x00, 0x80, 0x00, 0x81, 0x00, 0x81, 0x00, 0x80, 0x00, 0x81, 0x00,
+	0x81, 0x00, 0x80, 0x00, 0x81, 0x00, 0x86, 0x06, 0x81, 0x05, 0x81, 0x0f, 0x27, 0x84, 0x02, 0x80,
+	0x00, 0x81, 0x05, 0x81, 0x05, 0x84, 0x02, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x85,
+	0x20, 0x22, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x85, 0x00, 0x83, 0x00, 0x85, 0x00, 0x87, 0x00,
+	0x81, 0x1b, 0x22, 0x83, 0x03, 0x81, 0x04, 0x81, 0x04, 0x84, 0x01, 0x81, 0x01, 0x81, 0x00, 0x81,
+	0x01, 0x87, 0x1c, 0x1e, 0x83, 0x00, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x83, 0x03, 0x83, 0x01,
+	0x81, 0x00, 0x83, 0x18, 0x27, 0x81, 0x01, 0x82, 0x00, 0x81, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81,
+	0x00, 0x86, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x83, 0x01, 0x82, 0x20, 0x23,
+	0x87, 0x01, 0x81, 0x00, 0x81, 0x01, 0x81, 0x00, 0x85, 0x01, 0x81, 0x00, 0x81, 0x00, 0x81, 0x01,
+	0x81, 0x00, 0x81, 0x01, 0x82, 0x1b, 0x01, 0x80, 0x00, 0x80, 0x08, 0x86, 0x00, 0x81, 0x01, 0x81,
+	0x00, 0x81, 0x02, 0x80, 0x00, 0x81, 0x00, 0x80, 0x02, 0x83, 0x02, 0x81, 0x00, 0x80, 0x02, 0x81,
+	0x04, 0x81, 0x02, 0x80, 0x00, 0x81, 0x01, 0x88, 0x1b, 0x16, 0x80, 0x00, 0x80, 0x09, 0x84, 0x00,
+	0x81, 0x02, 0x8a, 0x04, 0x81, 0x04, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x0e, 0x84, 0x00, 0x81,
+	0x02, 0x83, 0x04, 0x81, 0x01, 0x80, 0x01, 0x84, 0x01, 0x81, 0x01, 0x80, 0x01, 0x81, 0x04, 0x81,
+	0x04, 0x81, 0x02, 0x81, 0x00, 0x84, 0x1c, 0x1e, 0x83, 0x00, 0x81, 0x01, 0x83, 0x03, 0x83, 0x01,
+	0x81, 0x03, 0x81, 0x01, 0x81, 0x00, 0x83, 0x18, 0x80, 0x00, 0x80, 0x04, 0x83, 0x00, 0x81, 0x01,
+	0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x00, 0x83, 0x0f,
+	0x0b, 0x80, 0x00, 0x80, 0x04, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81,
+	0x00, 0x83, 0x0f, 0x00, 0x80, 0x02, 0x80, 0x02, 0x82, 0x01, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02,
+	0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x85, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x1c,
+	0x15, 0x80, 0x02, 0x80, 0x02, 0x82, 0x01, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83, 0x02, 0x83,
+	0x02, 0x81, 0x00, 0x85, 0x04, 0x81, 0x04, 0x83, 0x02, 0x81, 0x00, 0x84, 0x07, 0x05, 0x82, 0x00,
+	0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x82, 0x37, 0x0d, 0x83, 0x0d, 0x0f, 0x81, 0x0d, 0x0e, 0x82,
+	0x02, 0x80, 0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x81, 0x00, 0x80,
+	0x02, 0x82, 0x03, 0x81, 0x04, 0x80, 0x19, 0x0f, 0x80, 0x02, 0x82, 0x00, 0x80, 0x02, 0x80, 0x02,
+	0x81, 0x01, 0x80, 0x00, 0x80, 0x00, 0x81, 0x01, 0x81, 0x00, 0x83, 0x00, 0x81, 0x00, 0x81, 0x00,
+	0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x82, 0x02, 0x80, 0x01, 0x81, 0x00, 0x82, 0x01,
+	0x81, 0x02, 0x80, 0x02, 0x80, 0x00, 0x81, 0x1f, 0x1b, 0x80, 0x00, 0x82, 0x00, 0x80, 0x00, 0x84,
+	0x00, 0x81, 0x02, 0x83, 0x02, 0x83, 0x02, 0x81, 0x00, 0x84, 0x00, 0x80, 0x00, 0x82, 0x00, 0x80,
+	0x22, 0x13, 0xa2, 0x18,
+};
+
+static const font_glyph_t font_prop16_glyphs[224] = {
+	{     0,  0,  4 },	// 0x20
+	{     0,  4,  5 },	// 0x21
+	{    15,  6,  7 },	// 0x22
+	{    28,  7,  8 },	// 0x23
+	{    61,  7,  8 },	// 0x24
+	{    90,  7,  8 },	// 0x25
+	{   111,  7,  8 },	// 0x26
+	{   146,  3,  4 },	// 0x27
+	{   153,  4,  5 },	// 0x28
+	{   174,  4,  5 },	// 0x29
+	{   195,  8,  9 },	// 0x2a
+	{   210,  6,  7 },	// 0x2b
+	{   221,  3,  4 },	// 0x2c
+	{   228,  7,  8 },	// 0x2d
+	{   231,  2,  3 },	// 0x2e
+	{   234,  7,  8 },	// 0x2f
+	{   251,  7,  8 },	// 0x30
+	{   282,  6,  7 },	// 0x31
+	{   303,  7,  8 },	// 0x32
+	{   326,  7,  8 },	// 0x33
+	{   349,  7,  8 },	// 0x34
+	{   374,  7,  8 },	// 0x35
+	{   393,  7,  8 },	// 0x36
+	{   416,  7,  8 },	// 0x37
+	{   437,  7,  8 },	// 0x38
+	{   462,  7,  8 },	// 0x39
+	{   485,  2,  3 },	// 0x3a
+	{   490,  3,  4 },	// 0x3b
+	{   499,  6,  7 },	// 0x3c
+	{   518,  6,  7 },	// 0x3d
+	{   523,  6,  7 },	// 0x3e
+	{   542,  7,  8 },	// 0x3f
+	{   563,  7,  8 },	// 0x40
+	{   584,  7,  8 },	// 0x41
+	{   607,  7,  8 },	// 0x42
+	{   640,  7,  8 },	// 0x43
+	{   665,  7,  8 },	// 0x44
+	{   702,  7,  8 },	// 0x45
+	{   733,  7,  8 },	// 0x46
+	{   762,  7,  8 },	// 0x47
+	{   789,  7,  8 },	// 0x48
+	{   810,  4,  5 },	// 0x49
+	{   831,  7,  8 },	// 0x4a
+	{   858,  7,  8 },	// 0x4b
+	{   893,  7,  8 },	// 0x4c
+	{   916,  7,  8 },	// 0x4d
+	{   937,  7,  8 },	// 0x4e
+	{   958,  7,  8 },	// 0x4f
+	{   981,  7,  8 },	// 0x50
+	{  1008,  7,  8 },	// 0x51
+	{  1037,  7,  8 },	// 0x52
+	{  1072,  7,  8 },	// 0x53
+	{  1095,  6,  7 },	// 0x54
+	{  1116,  7,  8 },	// 0x55
+	{  1139,  7,  8 },	// 0x56
+	{  1164,  7,  8 },	// 0x57
+	{  1193,  7,  8 },	// 0x58
+	{  1222,  6,  7 },	// 0x59
+	{  1245,  7,  8 },	// 0x5a
+	{  1266,  4,  5 },	// 0x5b
+	{  1285,  7,  8 },	// 0x5c
+	{  1304,  4,  5 },	// 0x5d
+	{  1323,  7,  8 },	// 0x5e
+	{  1336,  8,  9 },	// 0x5f
+	{  1339,  3,  4 },	// 0x60
+	{  1345,  7,  8 },	// 0x61
+	{  1368,  7,  8 },	// 0x62
+	{  1399,  7,  8 },	// 0x63
+	{  1416,  7,  8 },	// 0x64
+	{  1449,  7,  8 },	// 0x65
+	{  1464,  6,  7 },	// 0x66
+	{  1489,  7,  8 },	// 0x67
+	{  1520,  7,  8 },	// 0x68
+	{  1553,  4,  5 },	// 0x69
+	{  1572,  6,  7 },	// 0x6a
+	{  1597,  7,  8 },	// 0x6b
+	{  1626,  4,  5 },	// 0x6c
+	{  1647,  7,  8 },	// 0x6d
+	{  1672,  7,  8 },	// 0x6e
+	{  1701,  7,  8 },	// 0x6f
+	{  1718,  7,  8 },	// 0x70
+	{  1751,  7,  8 },	// 0x71
+	{  1782,  7,  8 },	// 0x72
+	{  1803,  7,  8 },	// 0x73
+	{  1822,  7,  8 },	// 0x74
+	{  1845,  7,  8 },	// 0x75
+	{  1874,  6,  7 },	// 0x76
+	{  1891,  7,  8 },	// 0x77
+	{  1914,  7,  8 },	// 0x78
+	{  1937,  7,  8 },	// 0x79
+	{  1960,  7,  8 },	// 0x7a
+	{  1975,  6,  7 },	// 0x7b
+	{  1996,  2,  3 },	// 0x7c
+	{  2001,  6,  7 },	// 0x7d
+	{  2022,  7,  8 },	// 0x7e
+	{  2029,  7,  8 },	// 0x7f
+	{  2046,  7,  8 },	// 0x80
+	{  2069,  7,  8 },	// 0x81
+	{  2100,  7,  8 },	// 0x82
+	{  2133,  7,  8 },	// 0x83
+	{  2158,  8,  9 },	// 0x84
+	{  2199,  7,  8 },	// 0x85
+	{  2230,  7,  8 },	// 0x86
+	{  2277,  7,  8 },	// 0x87
+	{  2300,  7,  8 },	// 0x88
+	{  2325,  7,  8 },	// 0x89
+	{  2354,  7,  8 },	// 0x8a
+	{  2389,  7,  8 },	// 0x8b
+	{  2414,  7,  8 },	// 0x8c
+	{  2435,  7,  8 },	// 0x8d
+	{  2456,  7,  8 },	// 0x8e
+	{  2479,  7,  8 },	// 0x8f
+	{  2500,  7,  8 },	// 0x90
+	{  2527,  7,  8 },	// 0x91
+	{  2552,  6,  7 },	// 0x92
+	{  2575,  7,  8 },	// 0x93
+	{  2598,  8,  9 },	// 0x94
+	{  2633,  7,  8 },	// 0x95
+	{  2662,  7,  8 },	// 0x96
+	{  2705,  7,  8 },	// 0x97
+	{  2728,  8,  9 },	// 0x98
+	{  2767,  8,  9 },	// 0x99
+	{  2810,  7,  8 },	// 0x9a
+	{  2841,  8,  9 },	// 0x9b
+	{  2872,  7,  8 },	// 0x9c
+	{  2899,  7,  8 },	// 0x9d
+	{  2926,  8,  9 },	// 0x9e
+	{  2965,  8,  9 },	// 0x9f
+	{  3000,  7,  8 },	// 0xa0
+	{  3023,  6,  7 },	// 0xa1
+	{  3048,  7,  8 },	// 0xa2
+	{  3069,  6,  7 },	// 0xa3
+	{  3088,  8,  9 },	// 0xa4
+	{  3117,  7,  8 },	// 0xa5
+	{  3132,  7,  8 },	// 0xa6
+	{  3167,  6,  7 },	// 0xa7
+	{  3184,  7,  8 },	// 0xa8
+	{  3203,  7,  8 },	// 0xa9
+	{  3226,  7,  8 },	// 0xaa
+	{  3249,  6,  7 },	// 0xab
+	{  3266,  7,  8 },	// 0xac
+	{  3283,  7,  8 },	// 0xad
+	{  3298,  7,  8 },	// 0xae
+	{  3315,  7,  8 },	// 0xaf
+	{  3330,  7,  8 },	// 0xb0
+	{  3379,  8,  9 },	// 0xb1
+	{  3492,  8,  9 },	// 0xb2
+	{  3557,  2,  3 },	// 0xb3
+	{  3558,  5,  6 },	// 0xb4
+	{  3588,  5,  6 },	// 0xb5
+	{  3616,  7,  8 },	// 0xb6
+	{  3678,  7,  8 },	// 0xb7
+	{  3712,  5,  6 },	// 0xb8
+	{  3732,  7,  8 },	// 0xb9
+	{  3790,  5,  6 },	// 0xba
+	{  3823,  7,  8 },	// 0xbb
+	{  3861,  7,  8 },	// 0xbc
+	{  3886,  7,  8 },	// 0xbd
+	{  3915,  5,  6 },	// 0xbe
+	{  3928,  5,  6 },	// 0xbf
+	{  3946,  5,  6 },	// 0xc0
+	{  3962,  8,  9 },	// 0xc1
+	{  3979,  8,  9 },	// 0xc2
+	{  3998,  5,  6 },	// 0xc3
+	{  4028,  8,  9 },	// 0xc4
+	{  4031,  8,  9 },	// 0xc5
+	{  4064,  5,  6 },	// 0xc6
+	{  4092,  6,  7 },	// 0xc7
+	{  4154,  6,  7 },	// 0xc8
+	{  4180,  6,  7 },	// 0xc9
+	{  4217,  8,  9 },	// 0xca
+	{  4244,  8,  9 },	// 0xcb
+	{  4283,  6,  7 },	// 0xcc
+	{  4341,  8,  9 },	// 0xcd
+	{  4346,  8,  9 },	// 0xce
+	{  4407,  8,  9 },	// 0xcf
+	{  4422,  8,  9 },	// 0xd0
+	{  4453,  8,  9 },	// 0xd1
+	{  4474,  8,  9 },	// 0xd2
+	{  4509,  6,  7 },	// 0xd3
+	{  4539,  5,  6 },	// 0xd4
+	{  4553,  5,  6 },	// 0xd5
+	{  4572,  6,  7 },	// 0xd6
+	{  4605,  8,  9 },	// 0xd7
+	{  4668,  8,  9 },	// 0xd8
+	{  4701,  5,  6 },	// 0xd9
+	{  4716,  5,  6 },	// 0xda
+	{  4733,  8,  9 },	// 0xdb
+	{  4734,  8,  9 },	// 0xdc
+	{  4736,  4,  5 },	// 0xdd
+	{  4737,  4,  5 },	// 0xde
+	{  4738,  8,  9 },	// 0xdf
+	{  4740,  7,  8 },	// 0xe0
+	{  4773,  7,  8 },	// 0xe1
+	{  4790,  6,  7 },	// 0xe2
+	{  4807,  7,  8 },	// 0xe3
+	{  4830,  8,  9 },	// 0xe4
+	{  4863,  7,  8 },	// 0xe5
+	{  4886,  7,  8 },	// 0xe6
+	{  4917,  7,  8 },	// 0xe7
+	{  4934,  7,  8 },	// 0xe8
+	{  4961,  8,  9 },	// 0xe9
+	{  5004,  8,  9 },	// 0xea
+	{  5025,  7,  8 },	// 0xeb
+	{  5042,  7,  8 },	// 0xec
+	{  5059,  6,  7 },	// 0xed
+	{  5076,  8,  9 },	// 0xee
+	{  5103,  7,  8 },	// 0xef
+	{  5126,  7,  8 },	// 0xf0
+	{  5161,  7,  8 },	// 0xf1
+	{  5180,  7,  8 },	// 0xf2
+	{  5207,  6,  7 },	// 0xf3
+	{  5224,  4,  5 },	// 0xf4
+	{  5248,  4,  5 },	// 0xf5
+	{  5267,  7,  8 },	// 0xf6
+	{  5296,  7,  8 },	// 0xf7
+	{  5325,  5,  6 },	// 0xf8
+	{  5336,  2,  3 },	// 0xf9
+	{  5339,  2,  3 },	// 0xfa
+	{  5342,  6,  7 },	// 0xfb
+	{  5367,  8,  9 },	// 0xfc
+	{  5416,  7,  8 },	// 0xfd
+	{  5441,  5,  6 },	// 0xfe
+	{     0,  0,  4 },	// 0xff
+};
+
+const font_t font_prop16 = {
+	16, 1, 0x20, 0xff, font_prop16_glyphs, font_prop16_data
+};
+
+static const uint8_t font_digits32_data[1002] = {
+	0x3f, 0x2f, 0x80, 0xc1, 0x80, 0x07, 0x81, 0xc3, 0x06, 0x40, 0xc5, 0x05, 0x80, 0xc2, 0x80, 0xc1,
+	0x80, 0x04, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2,
+	0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2,
+	0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x04, 0x80, 0xc1, 0x80, 0xc2, 0x80, 0x05,
+	0xc5, 0x40, 0x06, 0xc3, 0x81, 0x07, 0x80, 0xc1, 0x80, 0x3f, 0x2f, 0x3f, 0x3b, 0x80, 0xc1, 0x80,
+	0x07, 0xc3, 0x07, 0xc3, 0x06, 0x40, 0xc3, 0x40, 0x02, 0x80, 0xc9, 0x81, 0xc9, 0x80, 0x02, 0x40,
+	0xc3, 0x40, 0x06, 0xc3, 0x07, 0xc3, 0x07, 0x80, 0xc1, 0x80, 0x3f, 0x3f, 0x13, 0x3f, 0x3f, 0x3f,
+	0x03, 0x80, 0xcb, 0x81, 0xcb, 0x80, 0x3f, 0x3f, 0x3f, 0x1f, 0x3f, 0x0f, 0x80, 0xc1, 0x80, 0xc7,
+	0x80, 0xc1, 0x80, 0x1f, 0x3f, 0x3b, 0x81, 0x0a, 0x40, 0xc1, 0x09, 0x80, 0xc2, 0x08, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x08, 0xc2, 0x80, 0x09, 0xc1, 0x40, 0x0a, 0x81, 0x3f, 0x3b, 0x3b,
+	0x80, 0xc3, 0x80, 0x06, 0x40, 0xc5, 0x40, 0x04, 0x80, 0xc2, 0x41, 0xc2, 0x80, 0x02, 0x40, 0xc2,
+	0x80, 0x01, 0x80, 0xc2, 0x40, 0x00, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x80, 0xc3, 0x05, 0xc7,
+	0x05, 0xc7, 0x05, 0xc7, 0x01, 0x81, 0x01, 0xc7, 0x01, 0xc1, 0x01, 0xc7, 0x01, 0xc1, 0x01, 0xc7,
+	0x01, 0x81, 0x01, 0xc7, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc3, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2,
+	0x80, 0x00, 0x40, 0xc2, 0x80, 0x01, 0x80, 0xc2, 0x40, 0x02, 0x80, 0xc2, 0x41, 0xc2, 0x80, 0x04,
+	0x40, 0xc5, 0x40, 0x06, 0x80, 0xc3, 0x80, 0x3f, 0x33, 0x33, 0x80, 0xc1, 0x80, 0x06, 0x40, 0xc3,
+	0x05, 0x80, 0xc4, 0x04, 0x40, 0xc5, 0x03, 0x80, 0xc6, 0x03, 0x80, 0xc6, 0x06, 0x40, 0xc3, 0x07,
+	0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07, 0xc3, 0x07,
+	0xc3, 0x07, 0xc3, 0x06, 0x40, 0xc3, 0x40, 0x02, 0x80, 0xc9, 0x81, 0xc9, 0x80, 0x3f, 0x1f, 0x39,
+	0x80, 0xc7, 0x80, 0x02, 0x40, 0xc9, 0x40, 0x00, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x81, 0xc1,
+	0x80, 0x05, 0xc3, 0x09, 0xc3, 0x08, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x08, 0xc3, 0x09,
+	0xc3, 0x05, 0x80, 0xc1, 0x80, 0xc3, 0x40, 0x03, 0x40, 0xd1, 0x80, 0xcb, 0x80, 0x3f, 0x2f, 0x39,
+	0x80, 0xc7, 0x80, 0x02, 0x40, 0xc9, 0x40, 0x00, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x81, 0xc1,
+	0x80, 0x05, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x08, 0x40, 0xc2, 0x80, 0x03, 0x80, 0xc6,
+	0x40, 0x04, 0x80, 0xc6, 0x40, 0x09, 0x40, 0xc2, 0x80, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09,
+	0xc3, 0x09, 0xc3, 0x80, 0xc1, 0x80, 0x05, 0xc3, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x80, 0x00,
+	0x40, 0xc9, 0x40, 0x02, 0x80, 0xc7, 0x80, 0x3f, 0x31, 0x3f, 0x80, 0xc1, 0x80, 0x08, 0x40, 0xc3,
+	0x07, 0x80, 0xc4, 0x06, 0x40, 0xc5, 0x05, 0x80, 0xc6, 0x04, 0x40, 0xc7, 0x03, 0x80, 0xc2, 0x41,
+	0xc3, 0x02, 0x40, 0xc2, 0x80, 0x01, 0xc3, 0x01, 0x80, 0xc2, 0x40, 0x02, 0xc3, 0x01, 0xc3, 0x40,
+	0x01, 0x40, 0xc3, 0x40, 0x00, 0xcc, 0x81, 0xcb, 0x80, 0x06, 0x40, 0xc3, 0x40, 0x08, 0xc3, 0x09,
+	0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x08, 0x40, 0xc3, 0x40, 0x06, 0x80, 0xc5, 0x80, 0x05, 0x80, 0xc5,
+	0x80, 0x3f, 0x2f, 0x37, 0x80, 0xcb, 0x80, 0xcc, 0x80, 0xc3, 0x40, 0x08, 0xc3, 0x09, 0xc3, 0x09,
+	0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x40, 0x08, 0xca, 0x80, 0x01, 0x80, 0xca, 0x40, 0x09, 0x40, 0xc2,
+	0x80, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x80, 0xc1, 0x80, 0x05, 0xc3,
+	0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x80, 0x00, 0x40, 0xc9, 0x40, 0x02, 0x80, 0xc7, 0x80, 0x3f,
+	0x31, 0x3b, 0x80, 0xc3, 0x80, 0x06, 0x40, 0xc4, 0x80, 0x05, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2,
+	0x80, 0x07, 0x80, 0xc2, 0x40, 0x08, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x40, 0x08, 0xca, 0x80, 0x01,
+	0xcb, 0x40, 0x00, 0xc3, 0x40, 0x03, 0x40, 0xc2, 0x80, 0xc3, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7,
+	0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc3, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x80, 0x00, 0x40, 0xc9,
+	0x40, 0x02, 0x80, 0xc7, 0x80, 0x3f, 0x31, 0x37, 0x80, 0xcb, 0x80, 0xd1, 0x40, 0x03, 0x40, 0xc3,
+	0x80, 0xc1, 0x80, 0x05, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x08, 0x40, 0xc2, 0x80, 0x07,
+	0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x07,
+	0x80, 0xc2, 0x40, 0x08, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09,
+	0x80, 0xc1, 0x80, 0x3f, 0x35, 0x39, 0x80, 0xc7, 0x80, 0x02, 0x40, 0xc9, 0x40, 0x00, 0x80, 0xc2,
+	0x40, 0x03, 0x40, 0xc2, 0x80, 0xc3, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc3, 0x80, 0xc2,
+	0x40, 0x03, 0x40, 0xc2, 0x80, 0x00, 0x40, 0xc9, 0x40, 0x01, 0x40, 0xc9, 0x40, 0x00, 0x80, 0xc2,
+	0x40, 0x03, 0x40, 0xc2, 0x80, 0xc3, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7,
+	0x05, 0xc3, 0x80, 0xc2, 0x40, 0x03, 0x40, 0xc2, 0x80, 0x00, 0x40, 0xc9, 0x40, 0x02, 0x80, 0xc7,
+	0x80, 0x3f, 0x31, 0x39, 0x80, 0xc7, 0x80, 0x02, 0x40, 0xc9, 0x40, 0x00, 0x80, 0xc2, 0x40, 0x03,
+	0x40, 0xc2, 0x80, 0xc3, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc7, 0x05, 0xc3, 0x80, 0xc2, 0x40, 0x03,
+	0x40, 0xc3, 0x00, 0x40, 0xcb, 0x01, 0x80, 0xca, 0x08, 0x40, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09,
+	0xc3, 0x09, 0xc3, 0x08, 0x40, 0xc2, 0x80, 0x07, 0x80, 0xc2, 0x40, 0x07, 0x40, 0xc2, 0x80, 0x03,
+	0x80, 0xc6, 0x40, 0x04, 0x80, 0xc5, 0x80, 0x3f, 0x33, 0x1f, 0x80, 0xc1, 0x80, 0xc7, 0x80, 0xc1,
+	0x80, 0x17, 0x80, 0xc1, 0x80, 0xc7, 0x80, 0xc1, 0x80, 0x27, 0x3b, 0x80, 0xc5, 0x80, 0x04, 0x40,
+	0xc7, 0x40, 0x02, 0x80, 0xc2, 0x40, 0x01, 0x40, 0xc2, 0x80, 0x00, 0x40, 0xc2, 0x80, 0x03, 0x80,
+	0xc2, 0x80, 0xc2, 0x40, 0x05, 0x40, 0xc5, 0x07, 0x81, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3,
+	0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x09, 0xc3, 0x07, 0x82, 0xc2, 0x40, 0x05, 0x40,
+	0xc1, 0x00, 0x40, 0xc2, 0x80, 0x03, 0x80, 0xc2, 0x01, 0x80, 0xc2, 0x40, 0x01, 0x40, 0xc2, 0x80,
+	0x02, 0x40, 0xc7, 0x40, 0x04, 0x80, 0xc5, 0x80, 0x3f, 0x31,
+};
+
+static const font_glyph_t font_digits32_glyphs[36] = {
+	{     0,  0,  8 },	// 0x20
+	{     0,  0,  0 },	// 0x21
+	{     0,  0,  0 },	// 0x22
+	{     0,  0,  0 },	// 0x23
+	{     0,  0,  0 },	// 0x24
+	{     0, 14, 16 },	// 0x25
+	{     0,  0,  0 },	// 0x26
+	{     0,  0,  0 },	// 0x27
+	{     0,  0,  0 },	// 0x28
+	{     0,  0,  0 },	// 0x29
+	{     0,  0,  0 },	// 0x2a
+	{    75, 12, 14 },	// 0x2b
+	{     0,  0,  0 },	// 0x2c
+	{   109, 14, 16 },	// 0x2d
+	{   122,  4,  6 },	// 0x2e
+	{   132, 14, 16 },	// 0x2f
+	{   191, 14, 16 },	// 0x30
+	{   281, 12, 14 },	// 0x31
+	{   335, 14, 16 },	// 0x32
+	{   415, 14, 16 },	// 0x33
+	{   489, 14, 16 },	// 0x34
+	{   563, 14, 16 },	// 0x35
+	{   625, 14, 16 },	// 0x36
+	{   695, 14, 16 },	// 0x37
+	{   757, 14, 16 },	// 0x38
+	{   835, 14, 16 },	// 0x39
+	{   905,  4,  6 },	// 0x3a
+	{     0,  0,  0 },	// 0x3b
+	{     0,  0,  0 },	// 0x3c
+	{     0,  0,  0 },	// 0x3d
+	{     0,  0,  0 },	// 0x3e
+	{     0,  0,  0 },	// 0x3f
+	{     0,  0,  0 },	// 0x40
+	{     0,  0,  0 },	// 0x41
+	{     0,  0,  0 },	// 0x42
+	{   922, 14, 16 },	// 0x43
+};
+
+const font_t font_digits32 = {
+	32, 2, 0x20, 0x43, font_digits32_glyphs, font_digits32_data
+};
+
+static const uint8_t font_digits48_data[2484] = {
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b,
+	0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0b, 0x40, 0xd0, 0x40, 0xe0, 0xf3, 0xe0, 0x0a, 0x10, 0xe0, 0xf0,
+	0xe0, 0xf5, 0x09, 0x10, 0xb0, 0xf8, 0x08, 0x40, 0xe0, 0xf3, 0xe0, 0xf3, 0xe0, 0x07, 0x10, 0xe0,
+	0xf3, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x06, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0,
+	0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b,
+	0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0,
+	0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0,
+	0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b,
+	0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x06, 0x40, 0xe0, 0xf1, 0xe0,
+	0x40, 0xe0, 0xf3, 0xe0, 0x10, 0x07, 0xe0, 0xf3, 0xe0, 0xf3, 0xe0, 0x40, 0x08, 0xf8, 0xb0, 0x10,
+	0x09, 0xf5, 0xe0, 0xf0, 0xe0, 0x10, 0x0a, 0xe0, 0xf3, 0xe0, 0x40, 0xd0, 0x40, 0x0b, 0x40, 0xe0,
+	0xf1, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0b, 0xe0, 0xf3, 0xe0, 0x0b, 0xf5,
+	0x0b, 0xf5, 0x0a, 0x10, 0xf5, 0x10, 0x08, 0x10, 0xb0, 0xf5, 0xb0, 0x10, 0x03, 0x40, 0xe0, 0xfd,
+	0xe0, 0x40, 0xd0, 0xff, 0xd0, 0x40, 0xe0, 0xfd, 0xe0, 0x40, 0x03, 0x10, 0xb0, 0xf5, 0xb0, 0x10,
+	0x08, 0x10, 0xf5, 0x10, 0x0a, 0xf5, 0x0b, 0xf5, 0x0b, 0xe0, 0xf3, 0xe0, 0x0b, 0x40, 0xe0, 0xf1,
+	0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x09, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x08, 0x40, 0xe0, 0xff, 0xf0, 0xe0, 0x40, 0xd0, 0xff, 0xf2, 0xd0, 0x40, 0xe0, 0xff,
+	0xf0, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x40,
+	0xe0, 0xf1, 0xe0, 0x40, 0xe0, 0xf3, 0xe0, 0xfb, 0xe0, 0xf3, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x40, 0xd0, 0x40, 0x0f, 0x00, 0x10, 0xe0, 0xf0, 0xe0, 0x0f,
+	0x10, 0xb0, 0xf2, 0x0e, 0x40, 0xe0, 0xf3, 0x0d, 0x10, 0xe0, 0xf3, 0xe0, 0x0c, 0x10, 0xb0, 0xf3,
+	0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10,
+	0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10,
+	0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3,
+	0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10,
+	0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10,
+	0x0c, 0xe0, 0xf3, 0xe0, 0x10, 0x0d, 0xf3, 0xe0, 0x40, 0x0e, 0xf2, 0xb0, 0x10, 0x0f, 0xe0, 0xf0,
+	0xe0, 0x10, 0x0f, 0x00, 0x40, 0xd0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x03, 0x40, 0xe0, 0xf4, 0xe0, 0x40, 0x0a, 0x10, 0xe0, 0xf6, 0xe0, 0x10, 0x08, 0x10, 0xb0, 0xf8,
+	0xb0, 0x10, 0x06, 0x40, 0xe0, 0xf3, 0xb0, 0x20, 0xb0, 0xf3, 0xe0, 0x40, 0x04, 0x10, 0xe0, 0xf3,
+	0xe0, 0x10, 0x00, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x02, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x02, 0x40,
+	0xe0, 0xf3, 0xb0, 0x10, 0x00, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40,
+	0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0xf5, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb,
+	0x02, 0x40, 0xd0, 0x40, 0x02, 0xfb, 0x02, 0xe0, 0xf0, 0xe0, 0x02, 0xfb, 0x02, 0xf2, 0x02, 0xfb,
+	0x02, 0xf2, 0x02, 0xfb, 0x02, 0xe0, 0xf0, 0xe0, 0x02, 0xfb, 0x02, 0x40, 0xd0, 0x40, 0x02, 0xfb,
+	0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xf5, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40,
+	0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xf3, 0xe0, 0x40,
+	0x02, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x02, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x00, 0x10, 0xe0, 0xf3,
+	0xe0, 0x10, 0x04, 0x40, 0xe0, 0xf3, 0xb0, 0x20, 0xb0, 0xf3, 0xe0, 0x40, 0x06, 0x10, 0xb0, 0xf8,
+	0xb0, 0x10, 0x08, 0x10, 0xe0, 0xf6, 0xe0, 0x10, 0x0a, 0x40, 0xe0, 0xf4, 0xe0, 0x40, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x01, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x01, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0a, 0x10, 0xe0, 0xf3,
+	0xe0, 0x09, 0x10, 0xb0, 0xf5, 0x08, 0x40, 0xe0, 0xf6, 0x07, 0x10, 0xe0, 0xf7, 0x06, 0x10, 0xb0,
+	0xf8, 0x05, 0x40, 0xe0, 0xf9, 0x05, 0xd0, 0xfa, 0x05, 0x40, 0xe0, 0xf9, 0x09, 0x10, 0xb0, 0xf5,
+	0x0a, 0x10, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b,
+	0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0b, 0xf5, 0x0a,
+	0x10, 0xf5, 0x10, 0x08, 0x10, 0xb0, 0xf5, 0xb0, 0x10, 0x03, 0x40, 0xe0, 0xfd, 0xe0, 0x40, 0xd0,
+	0xff, 0xd0, 0x40, 0xe0, 0xfd, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x40, 0xe0,
+	0xfa, 0xe0, 0x40, 0x04, 0x10, 0xe0, 0xfc, 0xe0, 0x10, 0x02, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x00,
+	0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0xd0, 0xf3, 0xe0, 0x10, 0x06,
+	0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x08, 0xf5, 0x0e, 0xf5, 0x0d, 0x10, 0xf4, 0xe0,
+	0x0c, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3,
+	0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10,
+	0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10,
+	0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3,
+	0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40,
+	0xe0, 0xf3, 0xb0, 0x10, 0x0c, 0xe0, 0xf4, 0x10, 0x0d, 0xf5, 0x0e, 0xf5, 0x08, 0x40, 0xe0, 0xf1,
+	0xe0, 0x40, 0xf5, 0x10, 0x06, 0x10, 0xe0, 0xf3, 0xe0, 0xf5, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xff,
+	0xfa, 0xe0, 0xff, 0xf2, 0xe0, 0x40, 0xe0, 0xff, 0xf0, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x00, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x04, 0x10, 0xe0, 0xfc, 0xe0, 0x10, 0x02,
+	0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x00, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0,
+	0x40, 0xd0, 0xf3, 0xe0, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x08, 0xf5,
+	0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0d, 0x10, 0xf4, 0xe0, 0x0c, 0x10, 0xb0, 0xf3,
+	0xe0, 0x40, 0x05, 0x40, 0xe0, 0xf9, 0xb0, 0x10, 0x06, 0xd0, 0xfa, 0x20, 0x07, 0x40, 0xe0, 0xf9,
+	0xb0, 0x10, 0x0d, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0d, 0x10, 0xf4, 0xe0, 0x0e, 0xf5, 0x0e, 0xf5,
+	0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x08,
+	0xf5, 0xd0, 0xf3, 0xe0, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10,
+	0xb0, 0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x02, 0x10, 0xe0, 0xfc, 0xe0, 0x10,
+	0x04, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x09, 0x40,
+	0xe0, 0xf1, 0xe0, 0x40, 0x0d, 0x10, 0xe0, 0xf3, 0xe0, 0x0c, 0x10, 0xb0, 0xf5, 0x0b, 0x40, 0xe0,
+	0xf6, 0x0a, 0x10, 0xe0, 0xf7, 0x09, 0x10, 0xb0, 0xf8, 0x08, 0x40, 0xe0, 0xf9, 0x07, 0x10, 0xe0,
+	0xfa, 0x06, 0x10, 0xb0, 0xfb, 0x05, 0x40, 0xe0, 0xf3, 0xb0, 0x20, 0xb0, 0xf5, 0x04, 0x10, 0xe0,
+	0xf3, 0xe0, 0x10, 0x00, 0x10, 0xf5, 0x03, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x02, 0xf5, 0x02, 0x40,
+	0xe0, 0xf3, 0xb0, 0x10, 0x03, 0xf5, 0x02, 0xe0, 0xf4, 0x20, 0x03, 0x10, 0xf5, 0x10, 0x01, 0xf5,
+	0xb0, 0x10, 0x01, 0x10, 0xb0, 0xf5, 0xb0, 0x10, 0x00, 0xff, 0xf2, 0xe0, 0x40, 0xe0, 0xff, 0xf2,
+	0xd0, 0x40, 0xe0, 0xff, 0xf0, 0xe0, 0x40, 0x09, 0x10, 0xb0, 0xf5, 0xb0, 0x10, 0x0b, 0x10, 0xf5,
+	0x10, 0x0d, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0d, 0x10, 0xf5, 0x10, 0x0b,
+	0x10, 0xb0, 0xf5, 0xb0, 0x10, 0x09, 0x40, 0xe0, 0xf7, 0xe0, 0x40, 0x08, 0xd0, 0xf9, 0xd0, 0x08,
+	0x40, 0xe0, 0xf7, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0b, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d, 0x40, 0xe0, 0xff,
+	0xf0, 0xe0, 0x40, 0xe0, 0xff, 0xf2, 0xd0, 0xff, 0xf2, 0xe0, 0x40, 0xf5, 0xb0, 0x10, 0x0c, 0xf5,
+	0x10, 0x0d, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x10, 0x0d, 0xf5,
+	0xb0, 0x10, 0x0c, 0xff, 0xe0, 0x40, 0x02, 0xe0, 0xff, 0xe0, 0x10, 0x01, 0x40, 0xe0, 0xff, 0xb0,
+	0x10, 0x0d, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0d, 0x10, 0xf4, 0xe0, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e,
+	0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x08, 0xf5,
+	0xd0, 0xf3, 0xe0, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0,
+	0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x02, 0x10, 0xe0, 0xfc, 0xe0, 0x10, 0x04,
+	0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x40, 0xe0,
+	0xf4, 0xe0, 0x40, 0x0a, 0x10, 0xe0, 0xf6, 0xd0, 0x09, 0x10, 0xb0, 0xf6, 0xe0, 0x40, 0x08, 0x40,
+	0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40,
+	0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0c, 0xe0, 0xf4, 0x10, 0x0d, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5,
+	0x10, 0x0d, 0xf5, 0xb0, 0x10, 0x0c, 0xff, 0xe0, 0x40, 0x02, 0xff, 0xf0, 0xe0, 0x10, 0x01, 0xff,
+	0xf1, 0xb0, 0x10, 0x00, 0xf5, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0xf5, 0x10, 0x06,
+	0x10, 0xf4, 0xe0, 0xf5, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb,
+	0x08, 0xfb, 0x08, 0xf5, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf3, 0xb0, 0x10,
+	0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x02, 0x10, 0xe0, 0xfc,
+	0xe0, 0x10, 0x04, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0d,
+	0x40, 0xe0, 0xff, 0xf0, 0xe0, 0x40, 0xe0, 0xff, 0xf2, 0xe0, 0xff, 0xfa, 0xb0, 0x10, 0x04, 0x10,
+	0xb0, 0xf5, 0xe0, 0xf3, 0xe0, 0x10, 0x06, 0x10, 0xf5, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x08, 0xf5,
+	0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0d, 0x10, 0xf4, 0xe0, 0x0c, 0x10, 0xb0, 0xf3,
+	0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10,
+	0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10,
+	0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x0c, 0xe0, 0xf4, 0x10,
+	0x0d, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5,
+	0x0e, 0xe0, 0xf3, 0xe0, 0x0e, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x00, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x04, 0x10, 0xe0, 0xfc, 0xe0, 0x10, 0x02,
+	0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x00, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0,
+	0x40, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0xf5, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08,
+	0xfb, 0x08, 0xf5, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04,
+	0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x02, 0x20, 0xfe, 0x20, 0x02,
+	0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x00, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0,
+	0x40, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0xf5, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08,
+	0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xfb, 0x08, 0xf5, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0,
+	0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x00, 0x10, 0xb0, 0xfe, 0xb0,
+	0x10, 0x02, 0x10, 0xe0, 0xfc, 0xe0, 0x10, 0x04, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x00, 0x40, 0xe0, 0xfa, 0xe0, 0x40, 0x04, 0x10, 0xe0, 0xfc, 0xe0,
+	0x10, 0x02, 0x10, 0xb0, 0xfe, 0xb0, 0x10, 0x00, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x04, 0x10, 0xb0,
+	0xf3, 0xe0, 0x40, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf4, 0xe0, 0xf5, 0x08, 0xfb, 0x08, 0xfb, 0x08,
+	0xfb, 0x08, 0xfb, 0x08, 0xf5, 0xe0, 0xf4, 0x10, 0x06, 0x10, 0xf5, 0x40, 0xe0, 0xf3, 0xb0, 0x10,
+	0x04, 0x10, 0xb0, 0xf5, 0x00, 0x10, 0xb0, 0xff, 0xf1, 0x01, 0x10, 0xe0, 0xff, 0xf0, 0x02, 0x40,
+	0xe0, 0xff, 0x0c, 0x10, 0xb0, 0xf5, 0x0d, 0x10, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e,
+	0xf5, 0x0e, 0xf5, 0x0d, 0x10, 0xf4, 0xe0, 0x0c, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x0b, 0x40, 0xe0,
+	0xf3, 0xb0, 0x10, 0x0b, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x0b, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x05,
+	0x40, 0xe0, 0xf9, 0xb0, 0x10, 0x06, 0xd0, 0xf9, 0xe0, 0x10, 0x07, 0x40, 0xe0, 0xf7, 0xe0, 0x40,
+	0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x01, 0x0f, 0x0f, 0x0f, 0x0f, 0x07, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0xe0, 0xf3, 0xe0, 0xfb, 0xe0,
+	0xf3, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x05, 0x40, 0xe0, 0xf1, 0xe0, 0x40,
+	0xe0, 0xf3, 0xe0, 0xfb, 0xe0, 0xf3, 0xe0, 0x40, 0xe0, 0xf1, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x09, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x03, 0x40, 0xe0, 0xf7, 0xe0, 0x40,
+	0x07, 0x10, 0xe0, 0xf9, 0xe0, 0x10, 0x05, 0x10, 0xb0, 0xfb, 0xb0, 0x10, 0x03, 0x40, 0xe0, 0xf3,
+	0xb0, 0x10, 0x01, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x01, 0x10, 0xe0, 0xf3, 0xe0, 0x10, 0x03, 0x10,
+	0xe0, 0xf3, 0xe0, 0x00, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x05, 0x40, 0xe0, 0xf3, 0x40, 0xe0, 0xf3,
+	0xb0, 0x10, 0x07, 0x10, 0xb0, 0xf2, 0xe0, 0xf4, 0x10, 0x09, 0x10, 0xe0, 0xf0, 0xe0, 0xf5, 0x0b,
+	0x40, 0xd0, 0x40, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5,
+	0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0e, 0xf5, 0x0b, 0x40, 0xd0, 0x40,
+	0xe0, 0xf4, 0x10, 0x09, 0x10, 0xe0, 0xf0, 0xe0, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x07, 0x10, 0xb0,
+	0xf2, 0x00, 0x10, 0xb0, 0xf3, 0xe0, 0x40, 0x05, 0x40, 0xe0, 0xf3, 0x01, 0x10, 0xe0, 0xf3, 0xe0,
+	0x10, 0x03, 0x10, 0xe0, 0xf3, 0xe0, 0x02, 0x40, 0xe0, 0xf3, 0xb0, 0x10, 0x01, 0x10, 0xb0, 0xf3,
+	0xe0, 0x40, 0x03, 0x10, 0xb0, 0xfb, 0xb0, 0x10, 0x05, 0x10, 0xe0, 0xf9, 0xe0, 0x10, 0x07, 0x40,
+	0xe0, 0xf7, 0xe0, 0x40, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f,
+	0x0f, 0x0f, 0x0f, 0x0e,
+};
+
+static const font_glyph_t font_digits48_glyphs[36] = {
+	{     0,  0, 12 },	// 0x20
+	{     0,  0,  0 },	// 0x21
+	{     0,  0,  0 },	// 0x22
+	{     0,  0,  0 },	// 0x23
+	{     0,  0,  0 },	// 0x24
+	{     0, 21, 24 },	// 0x25
+	{     0,  0,  0 },	// 0x26
+	{     0,  0,  0 },	// 0x27
+	{     0,  0,  0 },	// 0x28
+	{     0,  0,  0 },	// 0x29
+	{     0,  0,  0 },	// 0x2a
+	{   195, 18, 21 },	// 0x2b
+	{     0,  0,  0 },	// 0x2c
+	{   295, 21, 24 },	// 0x2d
+	{   371,  6,  9 },	// 0x2e
+	{   405, 21, 24 },	// 0x2f
+	{   568, 21, 24 },	// 0x30
+	{   783, 18, 21 },	// 0x31
+	{   901, 21, 24 },	// 0x32
+	{  1099, 21, 24 },	// 0x33
+	{  1270, 21, 24 },	// 0x34
+	{  1445, 21, 24 },	// 0x35
+	{  1589, 21, 24 },	// 0x36
+	{  1752, 21, 24 },	// 0x37
+	{  1899, 21, 24 },	// 0x38
+	{  2077, 21, 24 },	// 0x39
+	{  2241,  6,  9 },	// 0x3a
+	{     0,  0,  0 },	// 0x3b
+	{     0,  0,  0 },	// 0x3c
+	{     0,  0,  0 },	// 0x3d
+	{     0,  0,  0 },	// 0x3e
+	{     0,  0,  0 },	// 0x3f
+	{     0,  0,  0 },	// 0x40
+	{     0,  0,  0 },	// 0x41
+	{     0,  0,  0 },	// 0x42
+	{  2290, 21, 24 },	// 0x43
+};
+
+const font_t font_digits48 = {
+	48, 4, 0x20, 0x43, font_digits48_glyphs, font_digits48_data
+};
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * File Name          : latency.c
+  * Description        : This file contains the touch latency tracer
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include <stdio.h>
+
+#include "latency.h"
+
+#if LATENCY_TRACE
+
+#include "cmsis_os.h"
+
+typedef struct {
+	const char *name;
+	uint8_t from;			// stamped stage before to, the latest from here on
+	uint8_t to;
+	uint8_t exact;			// from only
+} xLatencyRow_t;
+
+static const xLatencyRow_t rows[LATENCY_ROWS] = {
+	{ "edge>task",    LATENCY_EDGE,     LATENCY_TASK,     1 },
+	{ "task>sample",  LATENCY_TASK,     LATENCY_SAMPLE,   1 },
+	{ "sample>evt",   LATENCY_SAMPLE,   LATENCY_QUEUED,   1 },
+	{ "queue wait",   LATENCY_QUEUED,   LATENCY_DEQUEUED, 1 },
+	{ "beep",         LATENCY_DEQUEUED, LATENCY_BEEP,     1 },
+	{ "to pixel",     LATENCY_DEQUEUED, LATENCY_PIXEL,    0 },	// after the beep if any
+	{ "redraw",       LATENCY_PIXEL,    LATENCY_DONE,     1 },
+	{ "event>pixel",  LATENCY_QUEUED,   LATENCY_PIXEL,    1 },
+	{ "edge>pixel",   LATENCY_EDGE,     LATENCY_PIXEL,    1 }
+};
+
+static struct {
+	uint16_t count[LATENCY_BUCKETS];
+	uint32_t max;			// us, since the last halving
+} histogram[LATENCY_ROWS];
+
+static uint32_t stamp[LATENCY_STAGES];
+static volatile uint8_t stamped = 0;	// bit per stage, 0 - no trace
+static volatile uint32_t edge;			// CYCCNT of the last TOUCH_DI edge
+static volatile uint8_t edgePending = 0;
+static uint16_t traces = 0;				// since the last halving
+static uint32_t cyclesPerUs = 72;
+
+void latencyInit(void) {
+
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	cyclesPerUs = SystemCoreClock / 1000000;
+}
+
+/*
+ * EXTI callback: only the time, the touch task opens the trace
+ * */
+
+void latencyEdge(void) {
+
+	edge = DWT->CYCCNT;
+	edgePending = 1;
+}
+
+static uint8_t latencyBucket(uint32_t us) {
+
+	if (us < 2)
+		return 0;
+
+	uint8_t msb = 31 - __CLZ(us);
+	uint8_t b = 2 * msb + ((us >> (msb - 1)) & 1);
+
+	return (b < LATENCY_BUCKETS) ? b : LATENCY_BUCKETS - 1;
+}
+
+/* first us past bucket b */
+static uint32_t latencyBucketEnd(uint8_t b) {
+
+	b++;
+	return (b < 2) ? b + 1 : (uint32_t) (2 + (b & 1)) << (b / 2 - 1);
+}
+
+/*
+ * histograms from the stamps of the trace, called in a critical section
+ * */
+
+static void latencyCommit(void) {
+
+	uint8_t r, k;
+
+	for (r = 0; r < LATENCY_ROWS; r++) {
+
+		const xLatencyRow_t *row = &rows[r];
+		uint8_t from = row->from;
+
+		if (!(stamped & (1u << row->to)))
+			continue;
+		if (!row->exact)
+			for (k = row->to - 1; k > row->from; k--)
+				if (stamped & (1u << k)) {
+					from = k;
+					break;
+				}
+		if (!(stamped & (1u << from)))
+			continue;
+
+		uint32_t us = (stamp[row->to] - stamp[from]) / cyclesPerUs;
+		histogram[r].count[latencyBucket(us)]++;
+		if (us > histogram[r].max)
+			histogram[r].max = us;
+	}
+
+	if (++traces >= LATENCY_WINDOW) {
+		for (r = 0; r < LATENCY_ROWS; r++) {
+			for (k = 0; k < LATENCY_BUCKETS; k++)
+				histogram[r].count[k] >>= 1;
+			histogram[r].max = 0;
+		}
+		traces = 0;
+	}
+
+	stamped = 0;
+}
+
+/*
+ * task level stamp. The touch task opens a trace with LATENCY_TASK if an
+ * edge came in, closing what is left of the one before. Queue and beep
+ * stamps follow the latest event until the pixel, the pixel needs a
+ * dequeued event so that other drawing does not count
+ * */
+
+void latencyMark(uint8_t stage) {
+
+	uint32_t now = DWT->CYCCNT;
+
+	if (!stamped && !(stage == LATENCY_TASK && edgePending))
+		return;
+
+	taskENTER_CRITICAL();
+
+	switch (stage) {
+	case LATENCY_TASK:
+		if (edgePending) {
+			if (stamped)
+				latencyCommit();
+			edgePending = 0;
+			stamp[LATENCY_EDGE] = edge;
+			stamped = 1u << LATENCY_EDGE;
+		} else {
+			stage = LATENCY_STAGES;		// woken without an edge
+		}
+		break;
+
+	case LATENCY_QUEUED:
+	case LATENCY_DEQUEUED:
+	case LATENCY_BEEP:
+		if (stamped & (1u << LATENCY_PIXEL))
+			stage = LATENCY_STAGES;
+		else if (stage == LATENCY_QUEUED)
+			stamped &= ~((1u << LATENCY_DEQUEUED) | (1u << LATENCY_BEEP));
+		else if (stage == LATENCY_DEQUEUED)
+			stamped &= ~(1u << LATENCY_BEEP);
+		break;
+
+	case LATENCY_PIXEL:
+		if (!(stamped & (1u << LATENCY_DEQUEUED)) || (stamped & (1u << LATENCY_PIXEL)))
+			stage = LATENCY_STAGES;
+		break;
+
+	default:
+		if (stamped & (1u << stage))
+			stage = LATENCY_STAGES;
+		break;
+	}
+
+	if (stage < LATENCY_STAGES) {
+		stamp[stage] = now;
+		stamped |= 1u << stage;
+	}
+
+	taskEXIT_CRITICAL();
+}
+
+/*
+ * UI task, after an event: a trace that reached the pixel is complete, an
+ * event that did not draw gives up its dequeue and beep stamps
+ * */
+
+void latencyEnd(void) {
+
+	if (!stamped)
+		return;
+
+	taskENTER_CRITICAL();
+	if (stamped & (1u << LATENCY_PIXEL)) {
+		stamp[LATENCY_DONE] = DWT->CYCCNT;
+		stamped |= 1u << LATENCY_DONE;
+		latencyCommit();
+	} else {
+		stamped &= ~((1u << LATENCY_DEQUEUED) | (1u << LATENCY_BEEP));
+	}
+	taskEXIT_CRITICAL();
+}
+
+void latencyReset(void) {
+
+	taskENTER_CRITICAL();
+	for (uint8_t r = 0; r < LATENCY_ROWS; r++) {
+		for (uint8_t k = 0; k < LATENCY_BUCKETS; k++)
+			histogram[r].count[k] = 0;
+		histogram[r].max = 0;
+	}
+	traces = 0;
+	stamped = 0;
+	taskEXIT_CRITICAL();
+}
+
+static uint32_t latencyPercentile(const uint16_t *count, uint32_t total, uint8_t percent) {
+
+	uint32_t want = (total * percent + 99) / 100, sum = 0;
+	uint8_t k;
+
+	for (k = 0; k < LATENCY_BUCKETS - 1; k++)
+		if ((sum += count[k]) >= want)
+			break;
+	return latencyBucketEnd(k);
+}
+
+/* six columns: us, from 100 ms on ms with an "m" */
+static char *latencyValue(char *buffer, uint32_t us) {
+
+	if (us < 100000)
+		snprintf(buffer, 7, "%6lu", us);
+	else
+		snprintf(buffer, 7, "%5lum", us / 1000);
+	return buffer;
+}
+
+/*
+ * one line of the table, 40 columns, row -1 - the header; percentiles are
+ * bucket ends, "-" for a row without samples:
+ *	name          n   p50   p90   p99   max
+ * */
+
+void latencyFormat(int row, char *buffer, size_t size) {
+
+	uint16_t count[LATENCY_BUCKETS];
+	uint32_t total = 0, max;
+	char v[4][7];
+	uint8_t k;
+
+	if (row < 0 || row >= LATENCY_ROWS) {
+		snprintf(buffer, size, "%-11s%5s%6s%6s%6s%6s", "us", "n", "p50", "p90", "p99", "max");
+		return;
+	}
+
+	taskENTER_CRITICAL();
+	for (k = 0; k < LATENCY_BUCKETS; k++)
+		total += (count[k] = histogram[row].count[k]);
+	max = histogram[row].max;
+	taskEXIT_CRITICAL();
+
+	if (!total) {
+		snprintf(buffer, size, "%-11s%5s", rows[row].name, "-");
+		return;
+	}
+
+	snprintf(buffer, size, "%-11s%5lu%s%s%s%s", rows[row].name, total,
+			latencyValue(v[0], latencyPercentile(count, total, 50)),
+			latencyValue(v[1], latencyPercentile(count, total, 90)),
+			latencyValue(v[2], latencyPercentile(count, total, 99)),
+			latencyValue(v[3], max));
+}
+
+#endif /* LATENCY_TRACE */
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
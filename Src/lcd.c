@@ -1,7 +1,7 @@
 /**
   ******************************************************************************
   * @file   lcd.c
-  * @brief  This file contains useful stuff for ILI9325 LCD
+  * @brief  This file contains useful stuff for ILI9325/ILI9341/ST7789 LCD
   ******************************************************************************
   *
   * COPYRIGHT(c) 2016 Roman Stepanov
@@ -31,80 +31,240 @@
   ******************************************************************************
   */
 
+#if !LCD_HOST
 #include "stm32f1xx_hal.h"
 #include "cmsis_os.h"
+#endif
 #include "lcd.h"
+#include "lcd_bus.h"
 
+#if LCD_ORIENTATION >= 0
+static const uint8_t lcd_orientation = LCD_ORIENTATION;
+#else
 static uint8_t lcd_orientation = 0;
 
-void Lcd_Com(uint16_t addr) {
+// inside the driver the runtime bounds read the variable, no call
+#undef LCD_MAX_X
+#undef LCD_MAX_Y
+#define LCD_MAX_X	((lcd_orientation & 1) ?  320 : 240)
+#define LCD_MAX_Y	((lcd_orientation & 1) ?  240 : 320)
+#endif
+
+static const lcd_driver_t lcd_ili9325_driver;
+static const lcd_driver_t *lcd_driver = &lcd_ili9325_driver;
 
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET);
+void Lcd_Com(uint16_t addr) {
 
-	GPIOE->ODR = addr;
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
+	lcd_bus_com(addr);
 }
 
 void Lcd_Set_Data(uint16_t data) {
 
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET);
-
-	GPIOE->ODR = data;
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
+	lcd_bus_data_mode();
+	lcd_bus_write(data);
 }
 
 uint16_t Lcd_Get_Data() {
 
 	uint16_t data;
 
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET);
-
-	GPIOE->CRH = 0x44444444u;
-	GPIOE->CRL = 0x44444444u;
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_RESET);
-
-	data = GPIOE->IDR;
-	GPIOE->CRH = 0x33333333u;
-	GPIOE->CRL = 0x33333333u;
+	lcd_bus_data_mode();
+	lcd_bus_input();
+	data = lcd_bus_read();
+	lcd_bus_output();
 
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
 	return data;
 }
 
 void Lcd_Com_Data(uint16_t addr, uint16_t data) {
 
-	HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_RESET);
+	lcd_bus_com(addr);
+	lcd_bus_data_mode();
+	lcd_bus_write(data);
+}
+
+/*
+ * GRAM window (R50h..R53h) shadow: only changed registers are written, the
+ * default full-screen window is restored lazily by the cursor addressed
+ * primitives (Lcd_Put_Pix, Lcd_Get_Pix, spans), so a stream that is never
+ * closed can't leave the controller clipped
+ * */
+
+static uint16_t lcd_gram_window[4] = { 0, 239, 0, 319 };
 
-	GPIOE->ODR = addr;
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_RS_GPIO_Port, LCD_RS_Pin, GPIO_PIN_SET);
+static void lcd_gram_window_set(uint16_t hsa, uint16_t hea, uint16_t vsa, uint16_t vea) {
 
-	GPIOE->ODR = data;
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_RESET);
-	HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
+	if (lcd_gram_window[0] != hsa) Lcd_Com_Data(0x0050, lcd_gram_window[0] = hsa);
+	if (lcd_gram_window[1] != hea) Lcd_Com_Data(0x0051, lcd_gram_window[1] = hea);
+	if (lcd_gram_window[2] != vsa) Lcd_Com_Data(0x0052, lcd_gram_window[2] = vsa);
+	if (lcd_gram_window[3] != vea) Lcd_Com_Data(0x0053, lcd_gram_window[3] = vea);
 }
 
-void Lcd_Fill_Screen(uint16_t color) {
-	Lcd_Com_Data(0x20, 0);
-	Lcd_Com_Data(0x22, 0);
+void Lcd_Set_Window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+
+	if (lcd_orientation & 1) {
+		lcd_gram_window_set(y1, y2, x1, x2);
+	} else {
+		lcd_gram_window_set(x1, x2, y1, y2);
+	}
+}
+
+void Lcd_Reset_Window(void) {
+
+	lcd_gram_window_set(0, 239, 0, 319);
+}
+
+/*
+ * ILI9325 burst: a single row fits the full-screen window, so spans and
+ * pixels only move the cursor and the window registers stay untouched
+ * */
 
+static void ili9325_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint8_t read) {
+
+	// R22h is used both ways
+
+	if (height == 1) {
+		Lcd_Reset_Window();
+	} else {
+		Lcd_Set_Window(x, y, x + width - 1, y + height - 1);
+	}
+
+	Lcd_Go_XY(x, y);
 	Lcd_Com(0x0022);
+	lcd_bus_data_mode();
+	if (!read)
+		lcd_bus_gram_mark();
+}
+
+void Lcd_Stream_Begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+
+	lcd_driver->begin(x, y, width, height, 0);
+}
+
+void Lcd_Stream_Pixels(const uint16_t *pixels, uint32_t count) {
+
+	lcd_bus_sync();
+
+	for (; count >= 8; count -= 8) {
+		lcd_bus_write(*pixels++); lcd_bus_write(*pixels++);
+		lcd_bus_write(*pixels++); lcd_bus_write(*pixels++);
+		lcd_bus_write(*pixels++); lcd_bus_write(*pixels++);
+		lcd_bus_write(*pixels++); lcd_bus_write(*pixels++);
+	}
+
+	while (count--) {
+		lcd_bus_write(*pixels++);
+	}
+}
+
+void Lcd_Stream_Fill(uint16_t color, uint32_t count) {
+
+#if LCD_PUMP && !LCD_HOST
+	// long fills run in the background, short ones are cheaper bit-banged
+	if (count >= 256) {
+		Lcd_Pump_Fill(color, count, NULL, NULL);
+		return;
+	}
+#endif
+
+	lcd_bus_sync();
+
+	if (count) {
+		lcd_bus_write(color);
+		lcd_bus_repeat(count - 1);
+	}
+}
+
+/*
+ * palette expansion on the way to GRAM: 8 bit indices, or 4 bit pairs with
+ * the high nibble first, each looked up and written as one RGB565 word
+ * */
+
+void Lcd_Stream_Indexed(const uint8_t *indices, uint32_t count, uint8_t bpp,
+		const uint16_t *palette) {
+
+	lcd_bus_sync();
+
+	if (bpp == 4) {
+		for (; count >= 2; count -= 2) {
+			uint8_t pair = *indices++;
+			lcd_bus_write(palette[pair >> 4]);
+			lcd_bus_write(palette[pair & 0x0f]);
+		}
 
-	int j = 320 * 240;
+		if (count) {
+			lcd_bus_write(palette[*indices >> 4]);
+		}
+	} else {
+		for (; count >= 4; count -= 4) {
+			lcd_bus_write(palette[*indices++]); lcd_bus_write(palette[*indices++]);
+			lcd_bus_write(palette[*indices++]); lcd_bus_write(palette[*indices++]);
+		}
+
+		while (count--) {
+			lcd_bus_write(palette[*indices++]);
+		}
+	}
+}
+
+/*
+ * GRAM readback: the data bus is switched to input once per burst, the first
+ * word after R22h is a dummy read, then the address counter auto-increments
+ * inside the window like it does for writes
+ * */
+
+static void ili9325_read(uint16_t *buffer, uint32_t count) {
+
+	lcd_bus_input();
+	(void) lcd_bus_read();	// dummy read
+
+	for (; count >= 4; count -= 4) {
+		*buffer++ = lcd_bus_read();
+		*buffer++ = lcd_bus_read();
+		*buffer++ = lcd_bus_read();
+		*buffer++ = lcd_bus_read();
+	}
 
-	while (j--) {
-		Lcd_Set_Data(color);
+	while (count--) {
+		*buffer++ = lcd_bus_read();
 	}
+
+	lcd_bus_output();
+}
+
+void Lcd_Read_Region(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint16_t *buffer) {
+
+	uint32_t count = (uint32_t)width * height;
+
+	if (!count)
+		return;
+
+	lcd_driver->begin(x, y, width, height, 1);
+	lcd_driver->read(buffer, count);
+}
+
+void Lcd_Stream_End(void) {
+
+	// window stays, see Lcd_Reset_Window()
+}
+
+/*
+ * horizontal run: one row burst, the driver picks the cheapest addressing
+ * */
+
+static void lcd_span(uint16_t x, uint16_t y, uint16_t length, uint16_t color) {
+
+	lcd_driver->begin(x, y, length, 1, 0);
+	Lcd_Stream_Fill(color, length);
+}
+
+void Lcd_Fill_Screen(uint16_t color) {
+
+	Lcd_Stream_Begin(0, 0, LCD_MAX_X, LCD_MAX_Y);
+	Lcd_Stream_Fill(color, 320 * 240);
+	Lcd_Stream_End();
 }
 
 uint16_t Lcd_Get_RGB565(uint8_t red, uint8_t green, uint8_t blue) {
@@ -116,16 +276,10 @@ uint16_t Lcd_Get_RGB565(uint8_t red, uint8_t green, uint8_t blue) {
 	return c;
 }
 
-void Lcd_Init(uint8_t orientation) {
+static void ili9325_init(uint8_t orientation) {
 
 	uint16_t R01h, R03h, R60h;
 
-	lcd_orientation = orientation & 7;
-
-	// turn on backlight
-	HAL_GPIO_WritePin(LCD_BACKLIGHT_GPIO_Port, LCD_BACKLIGHT_Pin, GPIO_PIN_SET);
-	HAL_GPIO_WritePin(LCD_nCS_GPIO_Port, LCD_nCS_Pin, GPIO_PIN_RESET);
-
 	switch (orientation) {
 	case LCD_LANDSCAPE_CR:
 		R01h = (0 << 8) | (0 << 10);// SS = 0, SM = 0,  from S1 to S720 (see also  GS bit (R60h))
@@ -192,6 +346,11 @@ void Lcd_Init(uint8_t orientation) {
 	Lcd_Com_Data(0x0052, 0x0000);		  // Window Vertical RAM Address Start (R52h)
 	Lcd_Com_Data(0x0053, 319);			  // Window Vertical RAM Address End (R53h)
 
+	lcd_gram_window[0] = 0;
+	lcd_gram_window[1] = 239;
+	lcd_gram_window[2] = 0;
+	lcd_gram_window[3] = 319;
+
 	Lcd_Com_Data(0x0060, R60h);			  // Driver Output Control (R60h)
 	Lcd_Com_Data(0x0061, 0x0001);		  // Driver Output Control (R61h)
 	Lcd_Com_Data(0x0090, 0x0010);		  // Panel Interface Control 1 (R90h)
@@ -200,6 +359,75 @@ void Lcd_Init(uint8_t orientation) {
 	osDelay(100);
 }
 
+static const lcd_driver_t lcd_ili9325_driver = {
+	0x9325, "ILI9325", ili9325_init, ili9325_begin, ili9325_read
+};
+
+/* first entry is the fallback for an unknown ID */
+static const lcd_driver_t *const lcd_drivers[] = {
+	&lcd_ili9325_driver,
+	&lcd_ili9341_driver,
+	&lcd_st7789_driver
+};
+
+/*
+ * controller ID: ILI932x keep the device code in R00h, the MIPI DCS parts
+ * treat 00h as NOP and answer Read ID4 (D3h) or Read Display ID (04h)
+ * */
+
+int Lcd_Read_Id(void) {
+
+	uint16_t code;
+	uint32_t id;
+
+	Lcd_Com(0x0000);
+	code = Lcd_Get_Data();
+	if ((code & 0xff00) == 0x9300)
+		return code == 0x9328 ? 0x9325 : code;	// ILI9328 is register compatible
+
+	id = lcd_dcs_read_id(0xd3);					// 00h 93h 41h
+	if ((id & 0xffff) == 0x9341)
+		return 0x9341;
+
+	id = lcd_dcs_read_id(0x04);					// 85h 85h 52h
+	if (id == 0x858552)
+		return 0x7789;
+
+	return code;
+}
+
+void Lcd_Init(uint8_t orientation) {
+
+	int id;
+
+#if LCD_ORIENTATION < 0
+	lcd_orientation = orientation & 7;
+#else
+	(void) orientation;
+#endif
+
+	// turn on backlight
+	lcd_bus_select();
+
+	id = Lcd_Read_Id();
+	lcd_driver = lcd_drivers[0];
+	for (unsigned i = 0; i < sizeof(lcd_drivers) / sizeof(lcd_drivers[0]); i++) {
+		if (lcd_drivers[i]->id == id)
+			lcd_driver = lcd_drivers[i];
+	}
+
+	lcd_driver->init(lcd_orientation);
+
+#if LCD_PUMP && !LCD_HOST
+	Lcd_Pump_Init();
+#endif
+}
+
+const char *Lcd_Controller(void) {
+
+	return lcd_driver->name;
+}
+
 void Lcd_Go_XY (uint16_t x, uint16_t y)
 {
 	Lcd_Com_Data ((lcd_orientation & 1) ? 0x0021 : 0x0020, x);
@@ -208,16 +436,16 @@ void Lcd_Go_XY (uint16_t x, uint16_t y)
 
 void Lcd_Put_Pix (uint16_t x, uint16_t y, uint16_t col)
 {
-	Lcd_Go_XY (x, y);
-	Lcd_Com_Data (0x0022, col);  // col -  
+	lcd_driver->begin(x, y, 1, 1, 0);
+	lcd_bus_write(col);  // col -  
 }
 
 uint16_t Lcd_Get_Pix(uint16_t x, uint16_t y) {
 
-	Lcd_Go_XY (x, y);
-	Lcd_Com(0x0022);
+	uint16_t col;
 
-	return Lcd_Get_Data();
+	Lcd_Read_Region(x, y, 1, 1, &col);
+	return col;
 }
 
 static uint16_t copy_buf[320 << 1];
@@ -229,211 +457,813 @@ void Lcd_Copy_Region(uint16_t x1, uint16_t y1, uint16_t width, uint16_t height,
 		return;
 	}
 
-	for (uint16_t y = y1;
-			y < MIN(y1 + height, LCD_MAX_Y) && y - y1 + y2 < LCD_MAX_Y; y++) {
+	uint16_t w = MIN(x1 + width, LCD_MAX_X) - x1;
+	uint16_t h = MIN(y1 + height, LCD_MAX_Y) - y1;
+	if (x2 + w > LCD_MAX_X) w = LCD_MAX_X - x2;
+	if (y2 + h > LCD_MAX_Y) h = LCD_MAX_Y - y2;
+	if (!w || !h) return;
 
-		uint16_t *pb = copy_buf;
-		for (uint16_t x = x1; x < MIN(x1 + width, LCD_MAX_X); x++, pb++) {
-			*pb = Lcd_Get_Pix(x, y);
-		}
+	// as many rows per burst as copy_buf holds
+	uint16_t rows = sizeof(copy_buf) / sizeof(copy_buf[0]) / w;
 
-		Lcd_Go_XY (x2, y - y1 + y2);
-		Lcd_Com(0x0022);
+	// copy bottom-up when moving down so overlapping rows are read first
+	int down = y2 > y1;
 
-		pb = copy_buf;
+	for (uint16_t done = 0; done < h; ) {
 
-		for (uint16_t x = x2; x < MIN(x2 + width, LCD_MAX_X); x++, pb++) {
-			Lcd_Set_Data(*pb);
-		}
+		uint16_t n = MIN(rows, h - done);
+		uint16_t offset = down ? h - done - n : done;
+
+		Lcd_Read_Region(x1, y1 + offset, w, n, copy_buf);
+
+		Lcd_Stream_Begin(x2, y2 + offset, w, n);
+		Lcd_Stream_Pixels(copy_buf, (uint32_t)w * n);
+		Lcd_Stream_End();
+
+		done += n;
 	}
 }
 
+/*
+ * span rasterizer: every primitive is broken into horizontal runs (one cursor
+ * set + R22h each) or vertical runs (one 1 pixel wide window each)
+ * */
+
+static void lcd_hspan(int x, int y, int width, uint16_t color) {
+
+	if (x < 0) { width += x; x = 0; }
+	if (x + width > LCD_MAX_X) width = LCD_MAX_X - x;
+	if (y < 0 || y >= LCD_MAX_Y || width <= 0)
+		return;
+
+	lcd_span(x, y, width, color);
+}
+
+static void lcd_vspan(int x, int y, int height, uint16_t color) {
+
+	if (y < 0) { height += y; y = 0; }
+	if (y + height > LCD_MAX_Y) height = LCD_MAX_Y - y;
+	if (x < 0 || x >= LCD_MAX_X || height <= 0)
+		return;
+
+	Lcd_Stream_Begin(x, y, 1, height);
+	Lcd_Stream_Fill(color, height);
+	Lcd_Stream_End();
+}
+
+void Lcd_HLine(uint16_t x, uint16_t y, uint16_t width, uint16_t color) {
+	lcd_hspan(x, y, width, color);
+}
+
+void Lcd_VLine(uint16_t x, uint16_t y, uint16_t height, uint16_t color) {
+	lcd_vspan(x, y, height, color);
+}
+
 void Lcd_Line(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t c)
 {
-	int x, y, dx, dy, dx1, dy1, px, py, xe, ye, i;
-
-	dx = x2 - x1;
-	dy = y2 - y1;
-	dx1 = dx > 0 ? dx : -dx;
-	dy1 = dy > 0 ? dy : -dy;
-	px = 2 * dy1 - dx1;
-	py = 2 * dx1 - dy1;
-	if (dy1 <= dx1) {
-		if (dx >= 0) {
-			x = x1;
-			y = y1;
-			xe = x2;
-		} else {
-			x = x2;
-			y = y2;
-			xe = x1;
+	int x, y, dx, dy, err, start, step;
+
+	dx = x2 > x1 ? x2 - x1 : x1 - x2;
+	dy = y2 > y1 ? y2 - y1 : y1 - y2;
+
+	if (dy == 0) {
+		lcd_hspan(MIN(x1, x2), y1, dx + 1, c);
+		return;
+	}
+	if (dx == 0) {
+		lcd_vspan(x1, MIN(y1, y2), dy + 1, c);
+		return;
+	}
+
+	if (dy <= dx) {
+		// shallow: one horizontal run per y
+		if (x1 > x2) {
+			uint16_t t;
+			t = x1; x1 = x2; x2 = t;
+			t = y1; y1 = y2; y2 = t;
 		}
-		Lcd_Put_Pix(x, y, c);
-		for (i = 0; x < xe; i++) {
-			x = x + 1;
-			if (px < 0) {
-				px = px + 2 * dy1;
-			} else {
-				if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0)) {
-					y = y + 1;
-				} else {
-					y = y - 1;
-				}
-				px = px + 2 * (dy1 - dx1);
+		step = (y2 > y1) ? 1 : -1;
+		err = 2 * dy - dx;
+
+		for (x = start = x1, y = y1; x <= x2; x++) {
+			if (x == x2) {
+				lcd_hspan(start, y, x - start + 1, c);
+			} else if (err > 0) {
+				lcd_hspan(start, y, x - start + 1, c);
+				y += step;
+				start = x + 1;
+				err -= 2 * dx;
 			}
-			Lcd_Put_Pix(x, y, c);
+			err += 2 * dy;
 		}
 	} else {
-		if (dy >= 0) {
-			x = x1;
-			y = y1;
-			ye = y2;
+		// steep: one vertical run per x
+		if (y1 > y2) {
+			uint16_t t;
+			t = x1; x1 = x2; x2 = t;
+			t = y1; y1 = y2; y2 = t;
+		}
+		step = (x2 > x1) ? 1 : -1;
+		err = 2 * dx - dy;
+
+		for (y = start = y1, x = x1; y <= y2; y++) {
+			if (y == y2) {
+				lcd_vspan(x, start, y - start + 1, c);
+			} else if (err > 0) {
+				lcd_vspan(x, start, y - start + 1, c);
+				x += step;
+				start = y + 1;
+				err -= 2 * dy;
+			}
+			err += 2 * dx;
+		}
+	}
+}
+
+void Lcd_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color) {
+
+	if (x2 < x1 || y2 < y1)
+		return;
+
+	lcd_hspan(x1, y1, x2 - x1 + 1, color);
+	if (y2 > y1)
+		lcd_hspan(x1, y2, x2 - x1 + 1, color);
+	if (y2 - y1 > 1) {
+		lcd_vspan(x1, y1 + 1, y2 - y1 - 1, color);
+		if (x2 > x1)
+			lcd_vspan(x2, y1 + 1, y2 - y1 - 1, color);
+	}
+}
+
+/*
+ * half-width of a circle of radius r at row dy, the next row is found by
+ * walking x down from the current one (midpoint criterion x^2+dy^2 <= r^2+r)
+ * */
+
+__STATIC_INLINE int lcd_circle_x(int x, int dy, int r) {
+
+	while (x >= 0 && x * x + dy * dy > r * r + r) x--;
+	return x;
+}
+
+/*
+ * four rounded corners centered at (xl, yt), (xr, yt), (xl, yb), (xr, yb);
+ * xl == xr and yt == yb make a circle
+ * */
+
+static void lcd_round_spans(int xl, int yt, int xr, int yb, int r, uint8_t filled,
+		uint16_t color) {
+
+	int x = r;
+
+	for (int dy = 0; dy <= r; dy++) {
+
+		x = lcd_circle_x(x, dy, r);
+		int xn = (dy < r) ? lcd_circle_x(x, dy + 1, r) : -1;
+
+		if (filled || dy == r) {
+			lcd_hspan(xl - x, yt - dy, xr - xl + 2 * x + 1, color);
+			if (dy || yt != yb)
+				lcd_hspan(xl - x, yb + dy, xr - xl + 2 * x + 1, color);
+		} else {
+			// outline: pixels between this and the next row extent
+			int w = (x > xn) ? x - xn : 1;
+
+			lcd_hspan(xl - x, yt - dy, w, color);
+			lcd_hspan(xr + x - w + 1, yt - dy, w, color);
+			if (dy || yt != yb) {
+				lcd_hspan(xl - x, yb + dy, w, color);
+				lcd_hspan(xr + x - w + 1, yb + dy, w, color);
+			}
+		}
+	}
+
+	if (yb - yt > 1) {
+		if (filled) {
+			Lcd_Fill_Rect(MAX(xl - r, 0), MAX(yt + 1, 0), xr + r, yb - 1, color);
 		} else {
-			x = x2;
-			y = y2;
-			ye = y1;
+			lcd_vspan(xl - r, yt + 1, yb - yt - 1, color);
+			lcd_vspan(xr + r, yt + 1, yb - yt - 1, color);
+		}
+	}
+}
+
+void Lcd_Round_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t r,
+		uint16_t color) {
+
+	if (x2 < x1 || y2 < y1)
+		return;
+
+	r = MIN(r, MIN(x2 - x1, y2 - y1) / 2);
+	lcd_round_spans(x1 + r, y1 + r, x2 - r, y2 - r, r, 0, color);
+}
+
+void Lcd_Fill_Round_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t r,
+		uint16_t color) {
+
+	if (x2 < x1 || y2 < y1)
+		return;
+
+	r = MIN(r, MIN(x2 - x1, y2 - y1) / 2);
+	lcd_round_spans(x1 + r, y1 + r, x2 - r, y2 - r, r, 1, color);
+}
+
+void Lcd_Circle(uint16_t xc, uint16_t yc, uint16_t r, uint16_t color) {
+	lcd_round_spans(xc, yc, xc, yc, r, 0, color);
+}
+
+void Lcd_Fill_Circle(uint16_t xc, uint16_t yc, uint16_t r, uint16_t color) {
+	lcd_round_spans(xc, yc, xc, yc, r, 1, color);
+}
+
+/*
+ * sin(0..90 degrees), Q14
+ * */
+
+static const int16_t lcd_sin_q14[91] = {
+	    0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+	 2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+	 5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+	 8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+static int lcd_sin(int deg) {
+
+	deg %= 360;
+	if (deg < 0) deg += 360;
+
+	if (deg <= 90)  return  lcd_sin_q14[deg];
+	if (deg <= 180) return  lcd_sin_q14[180 - deg];
+	if (deg <= 270) return -lcd_sin_q14[deg - 180];
+	return -lcd_sin_q14[360 - deg];
+}
+
+static int lcd_cos(int deg) {
+	return lcd_sin(deg + 90);
+}
+
+typedef struct {
+	int sx, sy;		// start direction
+	int ex, ey;		// end direction
+	uint8_t wide;	// sweep is more than 180 degrees
+	uint8_t full;	// sweep is 360 degrees or more
+} lcd_sector_t;
+
+__STATIC_INLINE int lcd_in_sector(const lcd_sector_t *s, int px, int py) {
+
+	int from_start = s->sx * py - s->sy * px >= 0;	// clockwise of start
+	int to_end     = px * s->ey - py * s->ex >= 0;	// counterclockwise of end
+
+	return s->full || (s->wide ? (from_start || to_end) : (from_start && to_end));
+}
+
+/*
+ * run of the row dy from dx1 to dx2 (relative to the center), emitted as
+ * spans of the pixels inside the sector
+ * */
+
+static void lcd_sector_span(int xc, int yc, int dx1, int dx2, int dy,
+		const lcd_sector_t *s, uint16_t color) {
+
+	int start = dx1;
+
+	for (int dx = dx1; dx <= dx2; dx++) {
+		if (!lcd_in_sector(s, dx, dy)) {
+			if (dx > start)
+				lcd_hspan(xc + start, yc + dy, dx - start, color);
+			start = dx + 1;
 		}
-		Lcd_Put_Pix(x, y, c);
-		for (i = 0; y < ye; i++) {
-			y = y + 1;
-			if (py <= 0) {
-				py = py + 2 * dx1;
+	}
+
+	if (dx2 >= start)
+		lcd_hspan(xc + start, yc + dy, dx2 - start + 1, color);
+}
+
+/*
+ * filled ring segment between r_inner and r_outer, from start to end degrees;
+ * 0 is 3 o'clock, angles grow clockwise (screen Y points down)
+ * */
+
+void Lcd_Arc(uint16_t xc, uint16_t yc, uint16_t r_outer, uint16_t r_inner,
+		int16_t start, int16_t end, uint16_t color) {
+
+	lcd_sector_t s;
+	int sweep = end - start;
+
+	if (r_inner > r_outer)
+		return;
+
+	while (sweep < 0) sweep += 360;
+
+	s.sx = lcd_cos(start);
+	s.sy = lcd_sin(start);
+	s.ex = lcd_cos(end);
+	s.ey = lcd_sin(end);
+	s.wide = sweep > 180;
+	s.full = (end - start >= 360) || (start - end >= 360);
+
+	int xo = r_outer, xi = r_inner;
+
+	for (int dy = 0; dy <= r_outer; dy++) {
+
+		xo = lcd_circle_x(xo, dy, r_outer);
+		xi = (dy <= r_inner && r_inner) ? lcd_circle_x(xi, dy, r_inner) : -1;
+
+		for (int side = 0; side < (dy ? 2 : 1); side++) {
+
+			int py = side ? -dy : dy;
+
+			if (xi < 0) {
+				lcd_sector_span(xc, yc, -xo, xo, py, &s, color);
 			} else {
-				if ((dx < 0 && dy < 0) || (dx > 0 && dy > 0)) {
-					x = x + 1;
-				} else {
-					x = x - 1;
-				}
-				py = py + 2 * (dx1 - dy1);
+				lcd_sector_span(xc, yc, -xo, -xi - 1, py, &s, color);
+				lcd_sector_span(xc, yc, xi + 1, xo, py, &s, color);
 			}
-			Lcd_Put_Pix(x, y, c);
 		}
 	}
 }
 
 void Lcd_Render_Bitmap_8xN(uint16_t x, uint16_t y, uint8_t height, uint8_t *bitmap, uint16_t color)
 {
-	for (int y1=0; y1 < height; y1++) {
+	uint16_t max_x = LCD_MAX_X;
+	uint16_t max_y = LCD_MAX_Y;
 
-		if ((y1 + y < LCD_MAX_Y) && bitmap[y1]) {
+	for (int y1=0; y1 < height && y1 + y < max_y; y1++) {
 
-    	    for (int x1=0; x1<8; x1++) {
+		uint8_t bits = bitmap[y1];
+		int x1 = 0;
 
-    	    	if ((x1 + x < LCD_MAX_X) && (bitmap[y1] & 1 << x1)) {
+		// every run of set bits is one span
+		while (bits >> x1) {
 
-					Lcd_Put_Pix (x + x1, y + y1, color);
-				}
+			while (!(bits & 1 << x1)) x1++;
+
+			int x2 = x1;
+			while (x2 < 8 && (bits & 1 << x2)) x2++;
+
+			if (x + x2 > max_x) x2 = max_x - x;
+			if (x2 > x1) {
+				lcd_span(x + x1, y + y1, x2 - x1, color);
 			}
-    	}
+
+			x1 = x2;
+			if (x + x1 >= max_x) break;
+		}
     }
 }
 
+static uint8_t *lcd_glyph(uint8_t height, uint8_t idx) {
+
+	switch (height) {
+	case 14: return cp866_8x14_psf[idx];
+	case 16: return cp866_8x16_psf[idx];
+	case 8:	 return cp866_8x8_psf[idx];
+	default: return NULL;
+	}
+}
+
 void Lcd_Put_Text(uint16_t x, uint16_t y, uint8_t height, char *text, uint16_t color) {
 
 	uint8_t *bitmap;
 
 	for(; *text; x += 8, text++) {
 
-		int idx = *(uint8_t *)text;
+		if ((bitmap = lcd_glyph(height, *(uint8_t *)text)) == NULL)
+			return;
+
+		Lcd_Render_Bitmap_8xN(x, y, height, bitmap, color);
+	}
+}
+
+/*
+ * opaque text: the whole string is one window, every cell pixel is written
+ * once with either the foreground or the background color
+ * */
+
+void Lcd_Put_Text_Opaque(uint16_t x, uint16_t y, uint8_t height, char *text,
+		uint16_t color, uint16_t bgcolor) {
+
+	uint8_t *bitmaps[MAXTEXTLEN];
+	uint16_t len = 0;
+
+	if (x >= LCD_MAX_X || y >= LCD_MAX_Y || !lcd_glyph(height, 0))
+		return;
+
+	for (; text[len] && len < MAXTEXTLEN; len++)
+		bitmaps[len] = lcd_glyph(height, ((uint8_t *)text)[len]);
+
+	uint16_t width = MIN(len * 8, LCD_MAX_X - x);
+	uint8_t rows = MIN(height, LCD_MAX_Y - y);
+
+	if (!width)
+		return;
+
+	Lcd_Stream_Begin(x, y, width, rows);
 
-		switch (height) {
-		case 14: bitmap = cp866_8x14_psf[idx]; break;
-		case 16: bitmap = cp866_8x16_psf[idx]; break;
-		case 8:	 bitmap = cp866_8x8_psf[idx];  break;
-		default: return;
+	for (uint8_t row = 0; row < rows; row++) {
+
+		uint16_t left = width;
+
+		for (uint16_t c = 0; left; c++) {
+
+			uint8_t bits = bitmaps[c][row];
+			uint8_t n = MIN(left, 8);
+
+			left -= n;
+
+			for (uint8_t b = 0; b < n; b++, bits >>= 1) {
+				lcd_bus_write((bits & 1) ? color : bgcolor);
+			}
+		}
+	}
+
+	Lcd_Stream_End();
+}
+
+__STATIC_INLINE const font_glyph_t *lcd_font_glyph(const font_t *font, uint8_t c) {
+
+	if (c < font->first || c > font->last || !font->glyphs[c - font->first].advance)
+		return NULL;
+
+	return &font->glyphs[c - font->first];
+}
+
+uint16_t Lcd_Font_Text_Width(const font_t *font, const char *text) {
+
+	const font_glyph_t *glyph;
+	uint16_t width = 0;
+
+	for (; *text; text++) {
+		if ((glyph = lcd_font_glyph(font, *(uint8_t *)text)) != NULL)
+			width += glyph->advance;
+	}
+
+	return width;
+}
+
+/*
+ * one window per glyph, runs decoded straight to the bus; the gap up to the
+ * next glyph is filled with bgcolor, returns the pen position after text
+ * */
+
+uint16_t Lcd_Put_Font_Text(uint16_t x, uint16_t y, const font_t *font,
+		const char *text, uint16_t color, uint16_t bgcolor) {
+
+	const font_glyph_t *glyph;
+	uint16_t lut[16];
+	uint8_t levels = (1 << font->bpp) - 1;
+	uint8_t shift = 8 - font->bpp;
+	uint8_t runmask = (1 << shift) - 1;
+
+	if (y + font->height > LCD_MAX_Y)
+		return x;
+
+	// alpha -> RGB565 blend of bgcolor and color
+	for (uint8_t a = 0; a <= levels; a++) {
+		int r0 = bgcolor >> 11, g0 = (bgcolor >> 5) & 0x3f, b0 = bgcolor & 0x1f;
+		int r1 = color >> 11,   g1 = (color >> 5) & 0x3f,   b1 = color & 0x1f;
+
+		lut[a] = Lcd_Get_RGB565(r0 + (r1 - r0) * a / levels,
+				g0 + (g1 - g0) * a / levels, b0 + (b1 - b0) * a / levels);
+	}
+
+	for (; *text; text++) {
+
+		if ((glyph = lcd_font_glyph(font, *(uint8_t *)text)) == NULL)
+			continue;
+
+		if (x + glyph->advance > LCD_MAX_X)
 			break;
+
+		if (glyph->width) {
+
+			const uint8_t *run = font->data + glyph->offset;
+			uint32_t count = (uint32_t)glyph->width * font->height;
+
+			Lcd_Stream_Begin(x, y, glyph->width, font->height);
+
+			while (count) {
+				uint8_t n = (*run & runmask) + 1;
+
+				Lcd_Stream_Fill(lut[*run++ >> shift], n);
+				count -= n;
+			}
 		}
 
-		Lcd_Render_Bitmap_8xN(x, y, height, bitmap, color);
+		if (glyph->advance > glyph->width) {
+			Lcd_Stream_Begin(x + glyph->width, y, glyph->advance - glyph->width,
+					font->height);
+			Lcd_Stream_Fill(bgcolor, (uint32_t)(glyph->advance - glyph->width) * font->height);
+		}
+
+		Lcd_Stream_End();
+		x += glyph->advance;
 	}
+
+	return x;
 }
 
 void Lcd_Fill_Rect(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color) {
 
-	if ((int)x2 - x1 <= 0 || (int)y2 - y1 <= 0 || x1 >= LCD_MAX_X || y1 >= LCD_MAX_Y)
+	if ((int)x2 - x1 < 0 || (int)y2 - y1 < 0 || x1 >= LCD_MAX_X || y1 >= LCD_MAX_Y)
 		return;
 
 	if (x2 >= LCD_MAX_X) x2 = LCD_MAX_X - 1;
 	if (y2 >= LCD_MAX_Y) y2 = LCD_MAX_Y - 1;
 
-	for (int y = y1; y <= y2; y++) {
+	Lcd_Stream_Begin(x1, y1, x2 - x1 + 1, y2 - y1 + 1);
+	Lcd_Stream_Fill(color, (uint32_t)(x2 - x1 + 1) * (y2 - y1 + 1));
+	Lcd_Stream_End();
+}
 
-		Lcd_Go_XY (x1, y);
-		Lcd_Com (0x0022);
+/*
+ * strip renderer: a horizontal band of the target area is composed in RAM
+ * and flushed with one burst, the caller repeats its drawing for every strip
+ * and each primitive clips itself to the current band
+ * */
 
-		for (int x = x1; x <= x2; x++) {
-			Lcd_Set_Data (color);
-		}
+uint8_t Lcd_Strip_Begin(lcd_strip_t *strip, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height) {
+
+	if (x >= LCD_MAX_X || y >= LCD_MAX_Y || !width || !height)
+		return 0;
+
+	width = MIN(width, LCD_MAX_X - x);
+	height = MIN(height, LCD_MAX_Y - y);
+
+	// halve the strip until the heap can take it
+	uint16_t rows = MIN(height, MAX(LCD_STRIP_BUDGET / (width * 2), 1));
+
+	while ((strip->pixels = pvPortMalloc(rows * width * 2)) == NULL) {
+		if (rows == 1)
+			return 0;
+		rows >>= 1;
+	}
+
+	strip->x = x;
+	strip->y = y;
+	strip->width = width;
+	strip->height = rows;
+	strip->rows = rows;
+	strip->end = y + height;
+
+	return 1;
+}
+
+uint8_t Lcd_Strip_Next(lcd_strip_t *strip) {
+
+	Lcd_Stream_Begin(strip->x, strip->y, strip->width, strip->height);
+	Lcd_Stream_Pixels(strip->pixels, (uint32_t)strip->width * strip->height);
+	Lcd_Stream_End();
+
+	strip->y += strip->height;
+	if (strip->y >= strip->end) {
+		vPortFree(strip->pixels);
+		strip->pixels = NULL;
+		return 0;
 	}
+
+	strip->height = MIN(strip->rows, strip->end - strip->y);
+	return 1;
 }
 
-uint8_t Lcd_Orientation() {
-	return lcd_orientation;
+/* clip a screen rectangle to the strip, 0 - nothing left */
+
+static uint8_t lcd_strip_clip(const lcd_strip_t *strip, int *x1, int *y1, int *x2, int *y2) {
+
+	*x1 = MAX(*x1, strip->x);
+	*y1 = MAX(*y1, strip->y);
+	*x2 = MIN(*x2, strip->x + strip->width - 1);
+	*y2 = MIN(*y2, strip->y + strip->height - 1);
+
+	return *x1 <= *x2 && *y1 <= *y2;
 }
 
-void Lcd_Translate_Touch_Pos(uint16_t raw_x, uint16_t raw_y, uint16_t *x,
-		uint16_t *y) {
+__STATIC_INLINE uint16_t *lcd_strip_pixel(const lcd_strip_t *strip, int x, int y) {
+	return &strip->pixels[(y - strip->y) * strip->width + (x - strip->x)];
+}
 
-	if (raw_x < TOUCH_X_LOW)  raw_x = TOUCH_X_LOW;
-	if (raw_x > TOUCH_X_HIGH) raw_x = TOUCH_X_HIGH;
-	if (raw_y < TOUCH_Y_LOW)  raw_y = TOUCH_Y_LOW;
-	if (raw_y > TOUCH_Y_HIGH) raw_y = TOUCH_Y_HIGH;
+/* RGB565 alpha blend, alpha 0..255; all three channels in one multiply */
 
-	raw_x -= TOUCH_X_LOW;
-	raw_y -= TOUCH_Y_LOW;
+__STATIC_INLINE uint16_t lcd_blend(uint16_t bg, uint16_t fg, uint8_t alpha) {
 
-	switch (lcd_orientation) {
-	case LCD_LANDSCAPE_CL:
-		*x = 320 - (raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW));
-		if (*x > 320) *x = 1;
-		*y = raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW);
-		break;
-	case LCD_LANDSCAPE_CR:
-		*x = raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW);
-		*y = 240 - (raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW));
-		if (*y > 240) *y = 1;
-		break;
-	case LCD_PORTRAIT_CDN:
-		*x = raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW);
-		*y = raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW);
-		break;
-	case LCD_PORTRAIT_CUP:
-	default:
-		*x = 240 - (raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW));
-		if (*x > 240) *x = 1;
-		*y = 320 - (raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW));
-		if (*y > 320) *y = 1;
-		break;
+	uint32_t b = (bg | (uint32_t)bg << 16) & 0x07e0f81fu;
+	uint32_t f = (fg | (uint32_t)fg << 16) & 0x07e0f81fu;
+	uint32_t a = (alpha + 4) >> 3;
+
+	b = (((f - b) * a >> 5) + b) & 0x07e0f81fu;
+	return (uint16_t)(b >> 16 | b);
+}
+
+void Lcd_Strip_Fill_Rect(lcd_strip_t *strip, uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2, uint16_t color) {
+
+	int l = x1, t = y1, r = x2, b = y2;
+
+	if (!lcd_strip_clip(strip, &l, &t, &r, &b))
+		return;
+
+	for (; t <= b; t++) {
+		uint16_t *p = lcd_strip_pixel(strip, l, t);
+		for (int n = r - l + 1; n; n--) *p++ = color;
 	}
 }
 
-short Lcd_Touch_Get_Closest_Average(uint16_t *d3) {
+void Lcd_Strip_Blend_Rect(lcd_strip_t *strip, uint16_t x1, uint16_t y1,
+		uint16_t x2, uint16_t y2, uint16_t color, uint8_t alpha) {
 
-	int d[3];
-	int i, av = 0;
+	int l = x1, t = y1, r = x2, b = y2;
 
-	d[0] = d3[0] - d3[1]; // get the differentials
-	d[1] = d3[1] - d3[2];
-	d[2] = d3[2] - d3[0];
+	if (!lcd_strip_clip(strip, &l, &t, &r, &b))
+		return;
 
-	for (i = 0; i < 3; i++) { // get the absolute differentials
-		if (d[i] < 0) { d[i] = -d[i]; }
+	for (; t <= b; t++) {
+		uint16_t *p = lcd_strip_pixel(strip, l, t);
+		for (int n = r - l + 1; n; n--, p++) *p = lcd_blend(*p, color, alpha);
 	}
-	if (d[0] < d[1]) { // when d[0] < d[1]
-		if (d[0] < d[2]) { // compare d[0] to d[2]
-			av = d3[0] + d3[1]; // d[0] is the smallest if d[0] < d[2] also
-		} else {
-			av = d3[0] + d3[2]; // d[2] is the smallest if d[2] <= d[0] < d[1]
+}
+
+/*
+ * image rows are fetched straight into the strip, the reader gets the pixel
+ * offset in the width x height image and the visible pixel count
+ * */
+
+void Lcd_Strip_Image(lcd_strip_t *strip, uint16_t x, uint16_t y, uint16_t width,
+		uint16_t height, lcd_strip_reader_t reader, void *context) {
+
+	int l = x, t = y, r = x + width - 1, b = y + height - 1;
+
+	if (!width || !height || !lcd_strip_clip(strip, &l, &t, &r, &b))
+		return;
+
+	for (; t <= b; t++) {
+		reader(context, (uint32_t)(t - y) * width + (l - x),
+				lcd_strip_pixel(strip, l, t), r - l + 1);
+	}
+}
+
+void Lcd_Strip_Text(lcd_strip_t *strip, uint16_t x, uint16_t y, uint8_t height,
+		const char *text, uint16_t color) {
+
+	uint8_t *bitmap;
+
+	for (; *text; x += 8, text++) {
+
+		int l = x, t = y, r = x + 7, b = y + height - 1;
+
+		if ((bitmap = lcd_glyph(height, *(uint8_t *)text)) == NULL)
+			return;
+
+		if (x >= strip->x + strip->width)
+			return;
+
+		if (!lcd_strip_clip(strip, &l, &t, &r, &b))
+			continue;
+
+		for (; t <= b; t++) {
+			uint8_t bits = bitmap[t - y];
+			uint16_t *p = lcd_strip_pixel(strip, l, t);
+
+			for (int c = l; c <= r; c++, p++) {
+				if (bits & 1 << (c - x)) *p = color;
+			}
 		}
-	} else { // otherwise, i.e.: when d[1] <= d[0]
-		if (d[1] < d[2]) { // compare d[1] to d[2]
-			av = d3[1] + d3[2]; // d[1] is the smallest if d[1] < d[2] also
-		} else {
-			av = d3[0] + d3[2]; // d[2] is the smallest if d[2] <= d[1] <= d[0]
+	}
+}
+
+/* anti-aliased text blended over whatever the strip already holds */
+
+uint16_t Lcd_Strip_Font_Text(lcd_strip_t *strip, uint16_t x, uint16_t y,
+		const font_t *font, const char *text, uint16_t color) {
+
+	const font_glyph_t *glyph;
+	uint8_t levels = (1 << font->bpp) - 1;
+	uint8_t shift = 8 - font->bpp;
+	uint8_t runmask = (1 << shift) - 1;
+
+	for (; *text; text++) {
+
+		if ((glyph = lcd_font_glyph(font, *(uint8_t *)text)) == NULL)
+			continue;
+
+		int l = x, t = y, r = x + glyph->width - 1, b = y + font->height - 1;
+
+		if (glyph->width && lcd_strip_clip(strip, &l, &t, &r, &b)) {
+
+			const uint8_t *run = font->data + glyph->offset;
+			uint32_t count = (uint32_t)glyph->width * font->height;
+			uint32_t first = (uint32_t)(t - y) * glyph->width;
+			uint32_t last = (uint32_t)(b - y + 1) * glyph->width;
+			uint32_t pos = 0;
+
+			// runs cross glyph rows, walk them up to the last visible row
+			while (pos < count && pos < last) {
+
+				uint8_t alpha = *run >> shift;
+				uint32_t end = pos + (*run++ & runmask) + 1;
+
+				for (; alpha && pos < end; pos++) {
+
+					int px = x + pos % glyph->width;
+					if (pos < first || px < l || px > r)
+						continue;
+
+					uint16_t *p = lcd_strip_pixel(strip, px, y + pos / glyph->width);
+					*p = (alpha == levels) ? color : lcd_blend(*p, color, alpha * 255 / levels);
+				}
+				pos = end;
+			}
+		}
+
+		x += glyph->advance;
+	}
+
+	return x;
+}
+
+#if LCD_ORIENTATION < 0
+uint8_t Lcd_Orientation() {
+	return lcd_orientation;
+}
+#endif
+
+#if LCD_BENCHMARK
+
+#define BENCH_FRAMES	4
+
+static uint32_t lcd_pps(uint32_t pixels, uint32_t ticks) {
+	return ticks ? (uint32_t)((uint64_t)pixels * 1000 / ticks) : 0;
+}
+
+void Lcd_Benchmark(lcd_benchmark_t *result) {
+
+	static const uint16_t pattern[256] = { 0xf800, 0x07e0, 0x001f, 0xffff };
+	uint32_t pixels = BENCH_FRAMES * 320 * 240;
+	uint32_t start;
+
+	// per pixel calls, the way Lcd_Fill_Screen() worked before streaming
+	start = HAL_GetTick();
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		lcd_driver->begin(0, 0, LCD_MAX_X, LCD_MAX_Y, 0);
+		for (int i = 0; i < 320 * 240; i++) {
+			Lcd_Set_Data(f & 1 ? 0xffffu : 0);
+		}
+	}
+	result->setData = lcd_pps(pixels, HAL_GetTick() - start);
+
+	// bit-banged fill, Lcd_Stream_Fill() may hand it to the pump
+	start = HAL_GetTick();
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		Lcd_Stream_Begin(0, 0, LCD_MAX_X, LCD_MAX_Y);
+		lcd_bus_write(f & 1 ? 0xffffu : 0);
+		lcd_bus_repeat(320 * 240 - 1);
+	}
+	result->streamFill = lcd_pps(pixels, HAL_GetTick() - start);
+
+	start = HAL_GetTick();
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		Lcd_Stream_Begin(0, 0, LCD_MAX_X, LCD_MAX_Y);
+		for (int i = 0; i < 320 * 240; i += 256) {
+			Lcd_Stream_Pixels(pattern, 256);
+		}
+		Lcd_Stream_End();
+	}
+	result->streamPixels = lcd_pps(pixels, HAL_GetTick() - start);
+
+#if LCD_PUMP && !LCD_HOST
+	uint32_t ticks, spins = 0, idle = 0;
+
+	// the CPU counts while the pump fills, then counts as long without it
+	start = HAL_GetTick();
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		Lcd_Stream_Begin(0, 0, LCD_MAX_X, LCD_MAX_Y);
+		Lcd_Pump_Fill(f & 1 ? 0xffffu : 0, 320 * 240, NULL, NULL);
+		while (Lcd_Pump_Busy()) spins++;
+	}
+	ticks = HAL_GetTick() - start;
+	result->pumpFill = lcd_pps(pixels, ticks);
+
+	start = HAL_GetTick();
+	while (HAL_GetTick() - start < ticks) idle++;
+	result->pumpCpuFree = idle ? (uint32_t)((uint64_t)spins * 100 / idle) : 0;
+
+	start = HAL_GetTick();
+	for (int f = 0; f < BENCH_FRAMES; f++) {
+		Lcd_Stream_Begin(0, 0, LCD_MAX_X, LCD_MAX_Y);
+		for (int i = 0; i < 320 * 240; i += 256) {
+			Lcd_Pump_Pixels(pattern, 256, NULL, NULL);
 		}
+		Lcd_Pump_Wait();
 	}
-	av >>= 1;
-	return av;
+	result->pumpPixels = lcd_pps(pixels, HAL_GetTick() - start);
+#endif /* LCD_PUMP */
 }
+#endif /* LCD_BENCHMARK */
 
 /************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,242 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_dcs.c
+  * Description        : This file contains the ILI9341/ST7789 (MIPI DCS) LCD drivers
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#if !LCD_HOST
+#include "stm32f1xx_hal.h"
+#include "cmsis_os.h"
+#endif
+#include "lcd.h"
+#include "lcd_bus.h"
+
+/*
+ * MIPI DCS controllers on the same 16 bit 8080 bus: commands are one byte
+ * with RS low, parameters are bytes on D7..D0, pixels are RGB565 words
+ * (COLMOD 55h). The controller rotates the address counter itself (MADCTL),
+ * so CASET/PASET are always screen columns/rows and RAMWR restarts at the
+ * window origin: the window is the cursor, no separate address writes.
+ * */
+
+#define DCS_SWRESET		0x01
+#define DCS_RDDID		0x04
+#define DCS_SLPOUT		0x11
+#define DCS_NORON		0x13
+#define DCS_INVON		0x21
+#define DCS_DISPON		0x29
+#define DCS_CASET		0x2a
+#define DCS_PASET		0x2b
+#define DCS_RAMWR		0x2c
+#define DCS_RAMRD		0x2e
+#define DCS_MADCTL		0x36
+#define DCS_COLMOD		0x3a
+
+#define MADCTL_MY		0x80
+#define MADCTL_MX		0x40
+#define MADCTL_MV		0x20
+#define MADCTL_BGR		0x08
+
+/* CASET/PASET shadow, only changed ranges are written */
+static uint16_t dcs_window[4];
+
+static void dcs_command(uint8_t cmd, const uint8_t *params, uint8_t count) {
+
+	lcd_bus_com(cmd);
+	lcd_bus_data_mode();
+
+	while (count--) {
+		lcd_bus_write(*params++);
+	}
+}
+
+static void dcs_range(uint8_t cmd, uint16_t *shadow, uint16_t start, uint16_t end) {
+
+	if (shadow[0] == start && shadow[1] == end)
+		return;
+
+	lcd_bus_com(cmd);
+	lcd_bus_data_mode();
+	lcd_bus_write(start >> 8);
+	lcd_bus_write(start & 0xff);
+	lcd_bus_write(end >> 8);
+	lcd_bus_write(end & 0xff);
+
+	shadow[0] = start;
+	shadow[1] = end;
+}
+
+static void dcs_begin(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint8_t read) {
+
+	dcs_range(DCS_CASET, &dcs_window[0], x, x + width - 1);
+	dcs_range(DCS_PASET, &dcs_window[2], y, y + height - 1);
+
+	lcd_bus_com(read ? DCS_RAMRD : DCS_RAMWR);
+	lcd_bus_data_mode();
+	if (!read)
+		lcd_bus_gram_mark();
+}
+
+/*
+ * RAMRD returns 18 bit pixels as bytes R, G, B (6 bits each, left aligned),
+ * two bytes per bus word: two pixels take three words
+ * */
+
+static uint16_t dcs_rgb565(uint8_t r, uint8_t g, uint8_t b) {
+	return ((uint16_t)(r & 0xf8) << 8) | ((uint16_t)(g & 0xfc) << 3) | (b >> 3);
+}
+
+static void dcs_read(uint16_t *buffer, uint32_t count) {
+
+	uint16_t w0, w1, w2;
+
+	lcd_bus_input();
+	(void) lcd_bus_read();	// dummy read
+
+	for (; count >= 2; count -= 2) {
+		w0 = lcd_bus_read();
+		w1 = lcd_bus_read();
+		w2 = lcd_bus_read();
+		*buffer++ = dcs_rgb565(w0 >> 8, w0, w1 >> 8);
+		*buffer++ = dcs_rgb565(w1, w2 >> 8, w2);
+	}
+
+	if (count) {
+		w0 = lcd_bus_read();
+		w1 = lcd_bus_read();
+		*buffer = dcs_rgb565(w0 >> 8, w0, w1 >> 8);
+	}
+
+	lcd_bus_output();
+}
+
+/* common tail: pixel format, scan direction, window, display on */
+
+static void dcs_setup(uint8_t madctl) {
+
+	static const uint8_t colmod = 0x55;			// 16 bit/pixel
+
+	dcs_command(DCS_COLMOD, &colmod, 1);
+	dcs_command(DCS_MADCTL, &madctl, 1);
+
+	// force the first begin() to write both ranges
+	dcs_window[0] = dcs_window[1] = dcs_window[2] = dcs_window[3] = 0xffff;
+
+	dcs_command(DCS_NORON, NULL, 0);
+	dcs_command(DCS_DISPON, NULL, 0);
+	osDelay(20);
+}
+
+/* scan direction per orientation, same order as lcd_orientation_t */
+
+static const uint8_t dcs_madctl[4] = {
+	MADCTL_MX,								// LCD_PORTRAIT_CDN
+	MADCTL_MV,								// LCD_LANDSCAPE_CR
+	MADCTL_MY,								// LCD_PORTRAIT_CUP
+	MADCTL_MX | MADCTL_MY | MADCTL_MV		// LCD_LANDSCAPE_CL
+};
+
+static void ili9341_init(uint8_t orientation) {
+
+	static const uint8_t seq[] = {
+		// cmd, count, parameters...
+		0xcb, 5, 0x39, 0x2c, 0x00, 0x34, 0x02,	// Power control A
+		0xcf, 3, 0x00, 0xc1, 0x30,				// Power control B
+		0xe8, 3, 0x85, 0x00, 0x78,				// Driver timing control A
+		0xea, 2, 0x00, 0x00,					// Driver timing control B
+		0xed, 4, 0x64, 0x03, 0x12, 0x81,		// Power on sequence control
+		0xf7, 1, 0x20,							// Pump ratio control
+		0xc0, 1, 0x23,							// Power Control 1, GVDD 4.6 V
+		0xc1, 1, 0x10,							// Power Control 2
+		0xc5, 2, 0x3e, 0x28,					// VCOM Control 1
+		0xc7, 1, 0x86,							// VCOM Control 2
+		0xb1, 2, 0x00, 0x18,					// Frame Rate Control, 79 Hz
+		0xb6, 3, 0x08, 0x82, 0x27,				// Display Function Control
+		0xf2, 1, 0x00,							// 3Gamma Function Disable
+		0x26, 1, 0x01,							// Gamma curve 1
+		0
+	};
+
+	dcs_command(DCS_SWRESET, NULL, 0);
+	osDelay(120);
+
+	for (const uint8_t *p = seq; *p; p += 2 + p[1]) {
+		dcs_command(p[0], p + 2, p[1]);
+	}
+
+	dcs_command(DCS_SLPOUT, NULL, 0);
+	osDelay(120);
+
+	dcs_setup(dcs_madctl[orientation & 3] | MADCTL_BGR);
+}
+
+static void st7789_init(uint8_t orientation) {
+
+	dcs_command(DCS_SWRESET, NULL, 0);
+	osDelay(150);
+	dcs_command(DCS_SLPOUT, NULL, 0);
+	osDelay(120);
+
+	// the usual ST7789 IPS panels are RGB ordered and need inversion on
+	dcs_command(DCS_INVON, NULL, 0);
+	dcs_setup(dcs_madctl[orientation & 3]);
+}
+
+/*
+ * ID readback: the first parameter word of a read command is a dummy,
+ * the following bytes are returned packed, first one in the high byte
+ * */
+
+uint32_t lcd_dcs_read_id(uint8_t cmd) {
+
+	uint32_t id = 0;
+
+	lcd_bus_com(cmd);
+	lcd_bus_data_mode();
+	lcd_bus_input();
+	(void) lcd_bus_read();	// dummy read
+	for (int i = 0; i < 3; i++) {
+		id = (id << 8) | (lcd_bus_read() & 0xff);
+	}
+	lcd_bus_output();
+
+	return id;
+}
+
+const lcd_driver_t lcd_ili9341_driver = {
+	0x9341, "ILI9341", ili9341_init, dcs_begin, dcs_read
+};
+
+const lcd_driver_t lcd_st7789_driver = {
+	0x7789, "ST7789", st7789_init, dcs_begin, dcs_read
+};
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,189 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_gesture.c
+  * Description        : This file contains the touch gesture recognizer
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include "lcd.h"
+
+#define GESTURE_DOWN	0x01	// pen is down
+#define GESTURE_DRAG	0x02	// left the slop
+#define GESTURE_LONG	0x04	// long press reported
+
+static int16_t gesture_abs(int16_t v) {
+
+	return (v < 0) ? -v : v;
+}
+
+void Lcd_Gesture_Reset(gesture_state_t *state) {
+
+	state->flags = 0;
+	state->head = 0;
+	state->count = 0;
+}
+
+/*
+ * px/s over the samples of the last LCD_GESTURE_VELOCITY_MS before time
+ * */
+
+static void gesture_velocity(gesture_state_t *state, uint32_t time,
+		int16_t *vx, int16_t *vy) {
+
+	uint8_t last = (state->head + LCD_GESTURE_HISTORY - 1) % LCD_GESTURE_HISTORY;
+	uint8_t first = last;
+
+	*vx = *vy = 0;
+
+	for (uint8_t i = 1; i < state->count; i++) {
+
+		uint8_t k = (last + LCD_GESTURE_HISTORY - i) % LCD_GESTURE_HISTORY;
+		if (time - state->history[k].time > LCD_GESTURE_VELOCITY_MS)
+			break;
+		first = k;
+	}
+
+	// the pen rested before it was lifted
+	if (time - state->history[last].time > LCD_GESTURE_VELOCITY_MS)
+		return;
+
+	int32_t dt = state->history[last].time - state->history[first].time;
+	if (dt <= 0)
+		return;
+
+	int32_t x = (int32_t) (state->history[last].x - state->history[first].x) * 1000 / dt;
+	int32_t y = (int32_t) (state->history[last].y - state->history[first].y) * 1000 / dt;
+
+	*vx = (x > INT16_MAX) ? INT16_MAX : (x < -INT16_MAX) ? -INT16_MAX : x;
+	*vy = (y > INT16_MAX) ? INT16_MAX : (y < -INT16_MAX) ? -INT16_MAX : y;
+}
+
+/*
+ * feeds one sample (touch is a touch_state_t, x and y are ignored with
+ * TOUCH_UP), returns the gesture it completes or GESTURE_NONE
+ * */
+
+uint8_t Lcd_Gesture_Feed(gesture_state_t *state, uint32_t time, int16_t x, int16_t y,
+		uint8_t touch, gesture_t *gesture) {
+
+	gesture->type = GESTURE_NONE;
+	gesture->dx = gesture->dy = 0;
+
+	if (touch == TOUCH_UP) {
+
+		if (!(state->flags & GESTURE_DOWN))
+			return GESTURE_NONE;
+
+		int16_t dx = state->x - state->x0;
+		int16_t dy = state->y - state->y0;
+
+		gesture->x = state->x;
+		gesture->y = state->y;
+
+		if (!(state->flags & GESTURE_DRAG)) {
+			// the long press was the action, the release must not hit what is under it
+			if (!(state->flags & GESTURE_LONG))
+				gesture->type = GESTURE_TAP;
+
+		} else {
+			int16_t vx, vy;
+			gesture_velocity(state, time, &vx, &vy);
+
+			uint8_t horizontal = gesture_abs(dx) >= gesture_abs(dy);
+
+			if (time - state->down <= LCD_GESTURE_SWIPE_MS
+					&& (horizontal ? gesture_abs(dx) : gesture_abs(dy))
+							>= LCD_GESTURE_SWIPE_MIN) {
+
+				if (horizontal)
+					gesture->type = (dx < 0) ? GESTURE_SWIPE_LEFT : GESTURE_SWIPE_RIGHT;
+				else
+					gesture->type = (dy < 0) ? GESTURE_SWIPE_UP : GESTURE_SWIPE_DOWN;
+
+			} else if (gesture_abs(vx) >= LCD_GESTURE_FLING_MIN
+					|| gesture_abs(vy) >= LCD_GESTURE_FLING_MIN) {
+				gesture->type = GESTURE_FLING;
+			}
+
+			gesture->dx = vx;
+			gesture->dy = vy;
+		}
+
+		Lcd_Gesture_Reset(state);
+		return gesture->type;
+	}
+
+	if (!(state->flags & GESTURE_DOWN)) {
+		// a stream that lost its TOUCH_DOWN starts here as well
+		state->flags = GESTURE_DOWN;
+		state->down = time;
+		state->x0 = state->x = x;
+		state->y0 = state->y = y;
+		state->head = state->count = 0;
+	}
+
+	state->history[state->head].time = time;
+	state->history[state->head].x = x;
+	state->history[state->head].y = y;
+	state->head = (state->head + 1) % LCD_GESTURE_HISTORY;
+	if (state->count < LCD_GESTURE_HISTORY)
+		state->count++;
+
+	gesture->x = x;
+	gesture->y = y;
+
+	if (!(state->flags & GESTURE_DRAG)) {
+
+		if (gesture_abs(x - state->x0) <= LCD_GESTURE_SLOP
+				&& gesture_abs(y - state->y0) <= LCD_GESTURE_SLOP) {
+
+			if (!(state->flags & GESTURE_LONG)
+					&& time - state->down >= LCD_GESTURE_LONG_MS) {
+				state->flags |= GESTURE_LONG;
+				gesture->type = GESTURE_LONG_PRESS;
+			}
+			return gesture->type;
+		}
+
+		// the first MOVE covers the way out of the slop
+		state->flags |= GESTURE_DRAG;
+	}
+
+	if (x != state->x || y != state->y) {
+		gesture->type = GESTURE_MOVE;
+		gesture->dx = x - state->x;
+		gesture->dy = y - state->y;
+		state->x = x;
+		state->y = y;
+	}
+
+	return gesture->type;
+}
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
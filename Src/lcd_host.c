@@ -0,0 +1,216 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_host.c
+  * Description        : This file contains the ILI9325 emulation for host builds
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include "lcd.h"
+
+#if LCD_HOST
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "lcd_bus.h"
+
+/*
+ * the part of the ILI9325 lcd.c relies on: index register, entry mode (R03h
+ * I/D and AM), address counter (R20h/R21h), window (R50h..R53h) and GRAM
+ * access through R22h; scrolling and partial images are not emulated
+ * */
+
+static uint16_t host_reg[256] = {
+	[0x00] = 0x9325,
+	[0x51] = 239,
+	[0x53] = 319
+};
+
+static uint16_t host_gram[320 * 240];	// [gate][source]
+static uint16_t host_index = 0;
+static uint16_t host_last = 0;			// data word still on the bus
+static uint16_t host_h = 0, host_v = 0;	// address counter
+static uint8_t host_dummy = 0;			// next GRAM read is the dummy one
+
+static lcd_host_stats_t host_stats;
+
+uint32_t HAL_GetTick(void) {
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)(ts.tv_sec * 1000 + ts.tv_nsec / 1000000);
+}
+
+/* one address counter step inside the window, 1 - wrapped around */
+
+static int host_step(uint16_t *counter, int increment, uint16_t start, uint16_t end) {
+
+	if (increment) {
+		if (*counter >= end) {
+			*counter = start;
+			return 1;
+		}
+		(*counter)++;
+	} else {
+		if (*counter <= start) {
+			*counter = end;
+			return 1;
+		}
+		(*counter)--;
+	}
+
+	return 0;
+}
+
+static void host_advance(void) {
+
+	int id = (host_reg[0x03] >> 4) & 3;
+
+	if (host_reg[0x03] & (1 << 3)) {	// AM = 1, vertical first
+		if (host_step(&host_v, id & 2, host_reg[0x52], host_reg[0x53]))
+			host_step(&host_h, id & 1, host_reg[0x50], host_reg[0x51]);
+	} else {
+		if (host_step(&host_h, id & 1, host_reg[0x50], host_reg[0x51]))
+			host_step(&host_v, id & 2, host_reg[0x52], host_reg[0x53]);
+	}
+}
+
+void lcd_host_select(void) {
+}
+
+void lcd_host_com(uint16_t addr) {
+
+	host_stats.commands++;
+	host_index = addr & 0xff;
+	host_dummy = (host_index == 0x22);
+}
+
+void lcd_host_write(uint16_t data) {
+
+	host_stats.data++;
+	host_last = data;
+
+	switch (host_index) {
+	case 0x22:
+		if (host_h < 240 && host_v < 320)
+			host_gram[host_v * 240 + host_h] = data;
+		host_advance();
+		break;
+
+	case 0x20:
+		host_h = data & 0xff;
+		break;
+
+	case 0x21:
+		host_v = data & 0x1ff;
+		break;
+
+	case 0x50: case 0x51: case 0x52: case 0x53:
+		host_stats.windows++;
+		break;
+
+	default:
+		break;
+	}
+
+	if (host_index != 0x22)
+		host_reg[host_index] = data;
+}
+
+void lcd_host_repeat(uint32_t count) {
+
+	while (count--) {
+		lcd_host_write(host_last);
+	}
+}
+
+uint16_t lcd_host_read(void) {
+
+	uint16_t data;
+
+	host_stats.reads++;
+
+	if (host_index != 0x22)
+		return host_reg[host_index];
+
+	if (host_dummy) {
+		host_dummy = 0;
+		return 0;
+	}
+
+	data = (host_h < 240 && host_v < 320) ? host_gram[host_v * 240 + host_h] : 0;
+	host_advance();
+
+	return data;
+}
+
+void Lcd_Host_Stats(lcd_host_stats_t *stats, uint8_t reset) {
+
+	if (stats) *stats = host_stats;
+	if (reset) memset(&host_stats, 0, sizeof(host_stats));
+}
+
+/*
+ * binary PPM in Lcd_* screen coordinates: in landscape GRAM gates are the
+ * screen columns; panel mirroring (SS/GS) is left out
+ * */
+
+int Lcd_Host_Dump_PPM(const char *path) {
+
+	uint16_t width = LCD_MAX_X, height = LCD_MAX_Y;
+	FILE *file;
+
+	if ((file = fopen(path, "wb")) == NULL)
+		return -1;
+
+	fprintf(file, "P6\n%u %u\n255\n", width, height);
+
+	for (uint16_t y = 0; y < height; y++) {
+		for (uint16_t x = 0; x < width; x++) {
+
+			uint16_t c = (Lcd_Orientation() & 1) ? host_gram[x * 240 + y]
+					: host_gram[y * 240 + x];
+			uint8_t rgb[3] = {
+				(c >> 11) << 3 | (c >> 13),
+				((c >> 5) & 0x3f) << 2 | ((c >> 9) & 3),
+				(c & 0x1f) << 3 | ((c >> 2) & 7)
+			};
+
+			fwrite(rgb, 1, sizeof(rgb), file);
+		}
+	}
+
+	return fclose(file);
+}
+
+#endif /* LCD_HOST */
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
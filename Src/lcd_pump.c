@@ -0,0 +1,190 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_pump.c
+  * Description        : This file contains the TIM1/DMA1 pixel pump for the LCD bus
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include "lcd.h"
+
+#if LCD_PUMP && !LCD_HOST
+
+#include "lcd_bus.h"
+
+/*
+ * pixel pump: TIM1 CH2N (PB14, no remap) generates the nWR strobes, the CC4
+ * event of every period makes DMA1 channel 4 move the next word to GPIOE->ODR;
+ * channels 2 and 3 stay free for SPI1 (flash reads by DMA)
+ *
+ *	CNT		0 1 ... PUMP_HIGH ... PUMP_PERIOD-1 | 0
+ *	ODR		  ^ DMA writes word k
+ *	nWR		high ........ | low ............... | rising edge latches word k
+ *
+ * the timer runs in one pulse mode, the repetition counter stops it after
+ * up to 256 periods, the update interrupt starts the next chunk; nWR is high
+ * whenever the counter is stopped
+ * */
+
+#define PUMP_PERIOD	12		// TIM1 clocks per pixel, 72 MHz: 167 ns, 6 Mpixel/s
+#define PUMP_HIGH	5		// nWR high for the first PUMP_HIGH clocks
+#define PUMP_DMA	1		// CNT value of the DMA request, after the latch
+#define PUMP_CHUNK	256		// periods per run, repetition counter limit
+
+#define PUMP_PB14_MASK	(0xfu << 24)	// GPIOB->CRH bits of PB14
+#define PUMP_PB14_AF	(0xbu << 24)	// alternate function push-pull, 50 MHz
+
+static volatile uint32_t pump_left = 0;	// periods not started yet
+static volatile uint8_t pump_busy = 0;
+static uint32_t pump_pb14 = 0;			// PB14 mode to restore
+
+static lcd_pump_done_t pump_done = NULL;
+static void *pump_context = NULL;
+
+void Lcd_Pump_Init(void) {
+
+	__HAL_RCC_TIM1_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	TIM1->CR1 = TIM_CR1_OPM | TIM_CR1_URS;
+	TIM1->PSC = 0;
+	TIM1->ARR = PUMP_PERIOD - 1;
+	TIM1->CCR2 = PUMP_HIGH;
+	TIM1->CCR4 = PUMP_DMA;
+	TIM1->CCMR1 = TIM_CCMR1_OC2M_2 | TIM_CCMR1_OC2M_1;	// CH2 PWM mode 1
+	TIM1->CCMR2 = 0;									// CH4 frozen, DMA request only
+	TIM1->CCER = TIM_CCER_CC2NE;	// CH2N = OC2REF: high while CNT < CCR2
+	TIM1->BDTR = TIM_BDTR_MOE;
+	TIM1->DIER = TIM_DIER_UIE;
+
+	DMA1_Channel4->CPAR = (uint32_t) &GPIOE->ODR;
+
+	HAL_NVIC_SetPriority(TIM1_UP_IRQn, 5, 0);
+	HAL_NVIC_EnableIRQ(TIM1_UP_IRQn);
+}
+
+static void lcd_pump_chunk(void) {
+
+	uint32_t n = MIN(pump_left, PUMP_CHUNK);
+
+	pump_left -= n;
+
+	TIM1->RCR = n - 1;
+	TIM1->EGR = TIM_EGR_UG;		// load RCR, CNT = 0; no interrupt with URS
+	TIM1->CR1 |= TIM_CR1_CEN;
+}
+
+/* pixels == NULL: fill, the data lines already hold the color, no DMA */
+
+static void lcd_pump_start(const uint16_t *pixels, uint32_t count,
+		lcd_pump_done_t done, void *context) {
+
+	Lcd_Pump_Wait();
+
+	if (!count) {
+		if (done) done(context);
+		return;
+	}
+
+	pump_busy = 1;
+	pump_done = done;
+	pump_context = context;
+	pump_left = count;
+
+	if (pixels) {
+		DMA1_Channel4->CCR = 0;
+		DMA1_Channel4->CMAR = (uint32_t) pixels;
+		DMA1_Channel4->CNDTR = count;
+		DMA1_Channel4->CCR = DMA_CCR_PL_1 | DMA_CCR_MSIZE_0 | DMA_CCR_PSIZE_0
+				| DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN;
+		TIM1->DIER |= TIM_DIER_CC4DE;
+	}
+
+	// nWR from the GPIO to the timer, both keep it high
+	pump_pb14 = GPIOB->CRH & PUMP_PB14_MASK;
+	GPIOB->CRH = (GPIOB->CRH & ~PUMP_PB14_MASK) | PUMP_PB14_AF;
+
+	lcd_pump_chunk();
+}
+
+/*
+ * the bus must be in a data stream (Lcd_Stream_Begin()); pixels stay valid
+ * until the done callback (interrupt context) or Lcd_Pump_Wait(), at most
+ * 65535 per call
+ * */
+
+void Lcd_Pump_Pixels(const uint16_t *pixels, uint32_t count,
+		lcd_pump_done_t done, void *context) {
+
+	lcd_pump_start(pixels, MIN(count, 0xffffu), done, context);
+}
+
+void Lcd_Pump_Fill(uint16_t color, uint32_t count, lcd_pump_done_t done, void *context) {
+
+	Lcd_Pump_Wait();
+	GPIOE->ODR = color;
+	lcd_pump_start(NULL, count, done, context);
+}
+
+uint8_t Lcd_Pump_Busy(void) {
+
+	return pump_busy;
+}
+
+void Lcd_Pump_Wait(void) {
+
+	while (pump_busy) {
+		__WFI();	// the update interrupt ends every chunk
+	}
+}
+
+void Lcd_Pump_IRQHandler(void) {
+
+	if (!(TIM1->SR & TIM_SR_UIF))
+		return;
+
+	TIM1->SR = ~TIM_SR_UIF;
+
+	if (pump_left) {
+		lcd_pump_chunk();
+		return;
+	}
+
+	// back to the bit-banged bus, nWR high
+	TIM1->DIER &= ~TIM_DIER_CC4DE;
+	DMA1_Channel4->CCR = 0;
+	LCD_nWR_GPIO_Port->BSRR = LCD_nWR_Pin;
+	GPIOB->CRH = (GPIOB->CRH & ~PUMP_PB14_MASK) | pump_pb14;
+
+	pump_busy = 0;
+	if (pump_done) pump_done(pump_context);
+}
+
+#endif /* LCD_PUMP */
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,460 @@
+/**
+  ******************************************************************************
+  * File Name          : lcd_touch.c
+  * Description        : This file contains the XPT2046 touch sampler and calibration
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include "lcd.h"
+
+#if !LCD_HOST
+
+#include "cmsis_os.h"
+#include "mxconstants.h"
+
+/*
+ * one frame: every conversion is a command byte and two bytes that clock
+ * the 12 bit result out, left aligned after the busy bit. The commands are
+ * the ones the touch task always used: single ended, power down between
+ * conversions, PENIRQ on. 0xd4 measures along the X plate (y here), it is
+ * the one the touch resistance is computed with
+ *
+ *	TIM6 update	->	nCS low, DMA2 ch2 (SPI3 TX) and ch1 (SPI3 RX) run the frame
+ *	ch1 done	->	nCS high, filter, queue the sample
+ * */
+
+#define TOUCH_CMD_X		0x94
+#define TOUCH_CMD_Y		0xd4
+#define TOUCH_CMD_Z1	0xb4
+#define TOUCH_CMD_Z2	0xc4
+
+#define TOUCH_CONVERSIONS	(2 + 2 * LCD_TOUCH_FILTER)
+#define TOUCH_FRAME			(3 * TOUCH_CONVERSIONS)
+#define TOUCH_QUEUE			16		// samples the reader may lag behind
+#define TOUCH_TICK			100000	// TIM6 counter clock, Hz
+
+#if LCD_TOUCH_MEAN && LCD_TOUCH_FILTER < 3
+# error "LCD_TOUCH_MEAN needs at least 3 conversions per axis"
+#endif
+
+static uint8_t touch_tx[TOUCH_FRAME];
+static uint8_t touch_rx[TOUCH_FRAME];
+
+static QueueHandle_t touch_queue = NULL;
+static volatile uint8_t touch_busy = 0;	// frame on its way
+static volatile uint8_t touch_warmup = 0;	// first frame, powers the converter up, not used
+static uint8_t touch_down = 0;			// a touch was accepted since the start
+static uint8_t touch_misses = 0;		// frames without a touch in a row
+static touch_sample_t touch_last;
+
+static void lcd_touch_frame(void);
+
+void Lcd_Touch_Init(void) {
+
+	uint32_t clock = HAL_RCC_GetPCLK1Freq();
+	uint8_t i;
+
+	if ((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+		clock *= 2;		// APB1 timers run at twice the bus clock then
+
+	touch_queue = xQueueCreate(TOUCH_QUEUE, sizeof(touch_sample_t));
+
+	for (i = 0; i < TOUCH_CONVERSIONS; i++) {
+		touch_tx[3 * i] = (i == 0) ? TOUCH_CMD_Z1 : (i == 1) ? TOUCH_CMD_Z2
+				: (i < 2 + LCD_TOUCH_FILTER) ? TOUCH_CMD_X : TOUCH_CMD_Y;
+	}
+
+	__HAL_RCC_TIM6_CLK_ENABLE();
+	__HAL_RCC_DMA2_CLK_ENABLE();
+
+	TIM6->CR1 = TIM_CR1_URS;
+	TIM6->PSC = clock / TOUCH_TICK - 1;
+	TIM6->ARR = TOUCH_TICK / LCD_TOUCH_RATE - 1;
+	TIM6->EGR = TIM_EGR_UG;		// load PSC, no interrupt with URS
+	TIM6->DIER = TIM_DIER_UIE;
+
+	DMA2_Channel1->CPAR = (uint32_t) &SPI3->DR;
+	DMA2_Channel1->CMAR = (uint32_t) touch_rx;
+	DMA2_Channel2->CPAR = (uint32_t) &SPI3->DR;
+	DMA2_Channel2->CMAR = (uint32_t) touch_tx;
+
+	SPI3->CR1 |= SPI_CR1_SPE;
+
+	HAL_NVIC_SetPriority(TIM6_IRQn, 5, 0);
+	HAL_NVIC_EnableIRQ(TIM6_IRQn);
+	HAL_NVIC_SetPriority(DMA2_Channel1_IRQn, 5, 0);
+	HAL_NVIC_EnableIRQ(DMA2_Channel1_IRQn);
+
+	touch_warmup = 1;
+	touch_busy = 1;
+	lcd_touch_frame();
+}
+
+/* pen down: conversions toggle PENIRQ, its interrupt is off until the stream ends */
+
+void Lcd_Touch_Start(void) {
+
+	if (TIM6->CR1 & TIM_CR1_CEN)
+		return;
+
+	EXTI->IMR &= ~TOUCH_DI_Pin;
+
+	touch_down = 0;
+	touch_misses = 0;
+
+	TIM6->CNT = TIM6->ARR;		// the first frame on the next tick
+	TIM6->CR1 |= TIM_CR1_CEN;
+}
+
+static void lcd_touch_stop(void) {
+
+	TIM6->CR1 &= ~TIM_CR1_CEN;
+
+	EXTI->PR = TOUCH_DI_Pin;
+	EXTI->IMR |= TOUCH_DI_Pin;
+}
+
+/* timeout in ms; 0 - no sample came */
+
+uint8_t Lcd_Touch_Read(touch_sample_t *sample, uint32_t timeout) {
+
+	return xQueueReceive(touch_queue, sample, timeout / portTICK_PERIOD_MS) == pdTRUE;
+}
+
+void Lcd_Touch_Timer_IRQHandler(void) {
+
+	if (!(TIM6->SR & TIM_SR_UIF))
+		return;
+
+	TIM6->SR = ~TIM_SR_UIF;
+
+	if (touch_busy)
+		return;		// the previous frame is still running
+	touch_busy = 1;
+
+	lcd_touch_frame();
+}
+
+/* nCS low and the DMA channels on, the caller has set touch_busy */
+
+static void lcd_touch_frame(void) {
+
+	(void) SPI3->DR;	// stale byte, if any
+	TOUCH_nCS_GPIO_Port->BRR = TOUCH_nCS_Pin;
+
+	DMA2_Channel1->CCR = 0;
+	DMA2_Channel1->CNDTR = TOUCH_FRAME;
+	DMA2_Channel1->CCR = DMA_CCR_MINC | DMA_CCR_TCIE | DMA_CCR_EN;
+
+	DMA2_Channel2->CCR = 0;
+	DMA2_Channel2->CNDTR = TOUCH_FRAME;
+	DMA2_Channel2->CCR = DMA_CCR_MINC | DMA_CCR_DIR | DMA_CCR_EN;
+
+	SPI3->CR2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+}
+
+/* raw result of conversion i, as the touch task always read them */
+
+static uint16_t lcd_touch_value(uint8_t i) {
+
+	return ((uint16_t) touch_rx[3 * i + 1] << 8) | touch_rx[3 * i + 2];
+}
+
+/* median (or trimmed mean) of LCD_TOUCH_FILTER conversions starting at first */
+
+static uint16_t lcd_touch_filter(uint8_t first) {
+
+	uint16_t v[LCD_TOUCH_FILTER];
+	uint8_t i, j;
+
+	for (i = 0; i < LCD_TOUCH_FILTER; i++) {
+		uint16_t t = lcd_touch_value(first + i);
+
+		for (j = i; j && v[j - 1] > t; j--)
+			v[j] = v[j - 1];
+		v[j] = t;
+	}
+
+#if LCD_TOUCH_MEAN
+	uint32_t sum = 0;
+
+	for (i = 1; i < LCD_TOUCH_FILTER - 1; i++)
+		sum += v[i];
+	return sum / (LCD_TOUCH_FILTER - 2);
+#else
+	return v[LCD_TOUCH_FILTER / 2];
+#endif /* LCD_TOUCH_MEAN */
+}
+
+void Lcd_Touch_DMA_IRQHandler(void) {
+
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+	touch_sample_t sample;
+	uint32_t z1, z2, r;
+
+	if (!(DMA2->ISR & DMA_ISR_TCIF1))
+		return;
+
+	DMA2->IFCR = DMA_IFCR_CGIF1;
+	SPI3->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+	DMA2_Channel1->CCR = 0;
+	DMA2_Channel2->CCR = 0;
+	TOUCH_nCS_GPIO_Port->BSRR = TOUCH_nCS_Pin;
+	touch_busy = 0;
+
+	if (touch_warmup) {
+		touch_warmup = 0;
+		return;
+	}
+
+	z1 = lcd_touch_value(0) >> 3;
+	z2 = lcd_touch_value(1) >> 3;
+
+	sample.time = HAL_GetTick();
+	sample.x = lcd_touch_filter(2);
+	sample.y = lcd_touch_filter(2 + LCD_TOUCH_FILTER);
+
+	// Rtouch = Rx-plate * X / 4096 * (Z2 / Z1 - 1), in Rx-plate / 16
+	if (!z1)
+		r = 0xffffu;
+	else if (z2 <= z1)
+		r = 0;
+	else
+		r = MIN(((sample.y >> 3) * (z2 - z1) / z1) >> 8, 0xffffu);
+	sample.resistance = r;
+
+	if (z1 >= LCD_TOUCH_Z1_MIN && r <= LCD_TOUCH_R_MAX) {
+		touch_misses = 0;
+		sample.state = touch_down ? TOUCH_MOVE : TOUCH_DOWN;
+		touch_down = 1;
+		touch_last = sample;
+		xQueueSendFromISR(touch_queue, &sample, &xHigherPriorityTaskWoken);	// dropped if full
+
+	} else if (++touch_misses >= LCD_TOUCH_UP_FRAMES) {
+		if (touch_down) {
+			sample = touch_last;
+		} else {
+			sample.x = sample.y = 0;	// nothing but ghosts
+		}
+		sample.time = HAL_GetTick();
+		sample.state = TOUCH_UP;
+
+		// the stream always ends with its up sample, tried again next frame if full
+		if (xQueueSendFromISR(touch_queue, &sample, &xHigherPriorityTaskWoken) == pdTRUE)
+			lcd_touch_stop();
+	}
+
+	portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+#endif /* !LCD_HOST */
+
+/*
+ * calibration, host buildable
+ * */
+
+#define CAL_ONE			(1L << LCD_TOUCH_CAL_SHIFT)
+#define CAL_SCALE_MAX	(1L << 13)	// |a|, |b|, |d|, |e|: 1/8 px per raw unit
+#define CAL_OFFSET_MAX	(1L << 29)	// |c|, |f|; both keep the sums in 31 bits
+#define CAL_RAW_SHIFT	3			// raw is the 12 bit conversion << 3
+
+static touch_cal_t touch_cal;
+static volatile uint8_t touch_cal_set = 0;
+static touch_cal_t touch_default = { .orientation = 0xff };
+
+static void lcd_touch_default(uint8_t orientation, touch_cal_t *cal) {
+
+	int32_t sx = (320L << LCD_TOUCH_CAL_SHIFT) / (TOUCH_X_HIGH - TOUCH_X_LOW);
+	int32_t sy = (240L << LCD_TOUCH_CAL_SHIFT) / (TOUCH_Y_HIGH - TOUCH_Y_LOW);
+
+	cal->a = cal->b = cal->c = cal->d = cal->e = cal->f = 0;
+
+	// raw x runs along the long side, raw y along the short one
+	switch (orientation) {
+	case LCD_LANDSCAPE_CL:
+		cal->a = -sx;
+		cal->c = 320 * CAL_ONE + sx * TOUCH_X_LOW;
+		cal->e = sy;
+		cal->f = -sy * TOUCH_Y_LOW;
+		break;
+	case LCD_LANDSCAPE_CR:
+		cal->a = sx;
+		cal->c = -sx * TOUCH_X_LOW;
+		cal->e = -sy;
+		cal->f = 240 * CAL_ONE + sy * TOUCH_Y_LOW;
+		break;
+	case LCD_PORTRAIT_CDN:
+		cal->b = sy;
+		cal->c = -sy * TOUCH_Y_LOW;
+		cal->d = sx;
+		cal->f = -sx * TOUCH_X_LOW;
+		break;
+	case LCD_PORTRAIT_CUP:
+	default:
+		cal->b = -sy;
+		cal->c = 240 * CAL_ONE + sy * TOUCH_Y_LOW;
+		cal->d = -sx;
+		cal->f = 320 * CAL_ONE + sx * TOUCH_X_LOW;
+		break;
+	}
+
+	cal->orientation = orientation;
+}
+
+/*
+ * cal NULL - back to the matrix of TOUCH_X/Y_LOW/HIGH
+ * */
+
+void Lcd_Touch_Set_Calibration(const touch_cal_t *cal) {
+
+	touch_cal_set = 0;		// the touch task may be translating
+	if (cal) {
+		touch_cal = *cal;
+		touch_cal_set = 1;
+	}
+}
+
+void Lcd_Touch_Map(const touch_cal_t *cal, uint16_t raw_x, uint16_t raw_y,
+		int16_t *x, int16_t *y) {
+
+	// rounded to the nearest pixel
+	*x = (cal->a * raw_x + cal->b * raw_y + cal->c + CAL_ONE / 2) >> LCD_TOUCH_CAL_SHIFT;
+	*y = (cal->d * raw_x + cal->e * raw_y + cal->f + CAL_ONE / 2) >> LCD_TOUCH_CAL_SHIFT;
+}
+
+void Lcd_Translate_Touch_Pos(uint16_t raw_x, uint16_t raw_y, uint16_t *x,
+		uint16_t *y) {
+
+	const touch_cal_t *cal = &touch_cal;
+	uint8_t orientation = Lcd_Orientation();
+	int16_t px, py;
+
+	if (!touch_cal_set || touch_cal.orientation != orientation) {
+		if (touch_default.orientation != orientation)
+			lcd_touch_default(orientation, &touch_default);
+		cal = &touch_default;
+	}
+
+	Lcd_Touch_Map(cal, raw_x, raw_y, &px, &py);
+
+	*x = (px < 0) ? 0 : (px >= LCD_MAX_X) ? LCD_MAX_X - 1 : px;
+	*y = (py < 0) ? 0 : (py >= LCD_MAX_Y) ? LCD_MAX_Y - 1 : py;
+}
+
+static int64_t lcd_div_round(int64_t n, int64_t d) {
+
+	return (n < 0) ? -((-n + d / 2) / d) : (n + d / 2) / d;
+}
+
+/*
+ * least squares over the points, exact for 3. The sums are taken around
+ * the centroid, scaled by the point count to stay in integers, which
+ * leaves two 2x2 systems for a, b and d, e; c and f follow from the
+ * centroid. Returns 0 if the points are (nearly) collinear or the matrix
+ * comes out of range, cal is the matrix for the current orientation
+ * */
+
+uint8_t Lcd_Touch_Calibrate(const touch_point_t *raw, const touch_point_t *screen,
+		uint8_t points, touch_cal_t *cal) {
+
+	int32_t sx = 0, sy = 0, su = 0, sv = 0;
+	int64_t rx = 0, ry = 0;
+	int64_t xx = 0, xy = 0, yy = 0, xu = 0, yu = 0, xv = 0, yv = 0;
+	uint8_t i;
+
+	if (points < 3 || points > LCD_TOUCH_CAL_POINTS)
+		return 0;
+
+	for (i = 0; i < points; i++) {
+		sx += raw[i].x >> CAL_RAW_SHIFT;
+		sy += raw[i].y >> CAL_RAW_SHIFT;
+		rx += raw[i].x;
+		ry += raw[i].y;
+		su += screen[i].x;
+		sv += screen[i].y;
+	}
+
+	// |x|, |y| < 2^14 and |u|, |v| < 2^11: the products below stay in 63 bits
+	for (i = 0; i < points; i++) {
+		int32_t x = points * (raw[i].x >> CAL_RAW_SHIFT) - sx;
+		int32_t y = points * (raw[i].y >> CAL_RAW_SHIFT) - sy;
+		int32_t u = points * screen[i].x - su;
+		int32_t v = points * screen[i].y - sv;
+
+		xx += (int64_t) x * x;
+		xy += (int64_t) x * y;
+		yy += (int64_t) y * y;
+		xu += (int64_t) x * u;
+		yu += (int64_t) y * u;
+		xv += (int64_t) x * v;
+		yv += (int64_t) y * v;
+	}
+
+	int64_t det = xx * yy - xy * xy;
+	int64_t n[4] = {
+		xu * yy - yu * xy,		// a * det
+		yu * xx - xu * xy,		// b * det
+		xv * yy - yv * xy,		// d * det
+		yv * xx - xv * xy		// e * det
+	};
+	int32_t m[4];
+
+	// a sane panel has well under one pixel per (raw >> CAL_RAW_SHIFT)
+	for (; det >= (1LL << 40); det >>= 1)
+		for (i = 0; i < 4; i++)
+			n[i] /= 2;
+
+	if (det <= 0)
+		return 0;
+
+	for (i = 0; i < 4; i++) {
+		if (n[i] >= det || -n[i] >= det)
+			return 0;
+		m[i] = lcd_div_round(n[i] * (CAL_ONE >> CAL_RAW_SHIFT), det);
+		if (m[i] >= CAL_SCALE_MAX || -m[i] >= CAL_SCALE_MAX)
+			return 0;
+	}
+
+	int64_t c = lcd_div_round(((int64_t) su << LCD_TOUCH_CAL_SHIFT) - m[0] * rx - m[1] * ry, points);
+	int64_t f = lcd_div_round(((int64_t) sv << LCD_TOUCH_CAL_SHIFT) - m[2] * rx - m[3] * ry, points);
+
+	if (c >= CAL_OFFSET_MAX || -c >= CAL_OFFSET_MAX || f >= CAL_OFFSET_MAX || -f >= CAL_OFFSET_MAX)
+		return 0;
+
+	cal->a = m[0];
+	cal->b = m[1];
+	cal->c = c;
+	cal->d = m[2];
+	cal->e = m[3];
+	cal->f = f;
+	cal->orientation = Lcd_Orientation();
+	return 1;
+}
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
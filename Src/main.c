@@ -39,6 +39,8 @@
 /* USER CODE BEGIN Includes */
 #include "lcd.h"
 #include "ui.h"
+#include "ui_icon.h"
+#include "latency.h"
 
 /* USER CODE END Includes */
 
@@ -62,6 +64,9 @@ static osThreadId comm1TaskHandle;		// printing thread
 static osThreadId comm2TaskHandle;		// wi-fi/bt thread
 static osThreadId touchHandlerHandle;	// touch screen finger up/down
 static osThreadId sdcardHandlerHandle;	// sd card insert/remove
+#if ICON_CACHE_SIZE
+static osThreadId prefetchTaskHandle;	// icons of the next screens, when idle
+#endif
 
 QueueHandle_t xUIEventQueue;
 QueueHandle_t xPCommEventQueue;
@@ -93,6 +98,9 @@ void StartComm1Task(void const * argument);
 void StartComm2Task(void const * argument);
 void StartTouchHandlerTask(void const * argument);
 void StartSDHandlerTask(void const * argument);
+#if ICON_CACHE_SIZE
+void StartPrefetchTask(void const * argument);
+#endif
 
 void HAL_TIM_MspPostInit(TIM_HandleTypeDef *htim);
 /* USER CODE END PFP */
@@ -102,6 +110,10 @@ static SemaphoreHandle_t xTouchSemaphore;
 static SemaphoreHandle_t xSDSemaphore;
 static SemaphoreHandle_t xComm1Semaphore;
 static SemaphoreHandle_t xComm2Semaphore;
+static SemaphoreHandle_t xComm1TxMutex;
+#if ICON_CACHE_SIZE
+static SemaphoreHandle_t xPrefetchSemaphore;
+#endif
 /* USER CODE END 0 */
 
 int main(void)
@@ -129,11 +141,13 @@ int main(void)
 	MX_USART3_UART_Init();
 
 	/* USER CODE BEGIN 2 */
+	latencyInit();
 
 	/* USER CODE END 2 */
 
 	/* USER CODE BEGIN RTOS_MUTEX */
 	/* add mutexes, ... */
+	xComm1TxMutex = xSemaphoreCreateMutex();
 	/* USER CODE END RTOS_MUTEX */
 
 	/* USER CODE BEGIN RTOS_SEMAPHORES */
@@ -142,6 +156,10 @@ int main(void)
 	xSDSemaphore    = xSemaphoreCreateBinary();
 	xComm1Semaphore = xSemaphoreCreateBinary();
 	xComm2Semaphore = xSemaphoreCreateBinary();
+#if ICON_CACHE_SIZE
+	xPrefetchSemaphore = xSemaphoreCreateBinary();
+#endif
+	uiIconLockInit();
 	/* USER CODE END RTOS_SEMAPHORES */
 
 	/* USER CODE BEGIN RTOS_TIMERS */
@@ -167,6 +185,11 @@ int main(void)
 
 	osThreadDef(uiTask, StartUITask, osPriorityNormal, 0, 14 * 1024 / 4);
 	uiTaskHandlerHandle = osThreadCreate(osThread(uiTask), NULL);
+
+#if ICON_CACHE_SIZE
+	osThreadDef(prefetchTask, StartPrefetchTask, osPriorityLow, 0, 256);
+	prefetchTaskHandle = osThreadCreate(osThread(prefetchTask), NULL);
+#endif
 	/* USER CODE END RTOS_THREADS */
 
 	/* USER CODE BEGIN RTOS_QUEUES */
@@ -532,6 +555,7 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 
 	switch (GPIO_Pin) {
 	case TOUCH_DI_Pin:
+		latencyEdge();
 		xSemaphoreGiveFromISR(xTouchSemaphore, &xHigherPriorityTaskWoken);
 		break;
 	case SDCARD_DETECT_Pin:
@@ -547,87 +571,114 @@ static uint16_t xTouchY = 0;
 
 void StartTouchHandlerTask(void const * argument) {
 
-	uint8_t pTxData[3] = { 0xd4, 0, 0 };
-	uint8_t pRxData[3];
-
-	/* warmup */
-	HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3, 1000);
-	pTxData[0] = 0x94;
-	HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3, 1000);
+	/*
+	 * datasheet: https://ldm-systems.ru/f/doc/catalog/HY-TFT-2,8/XPT2046.pdf
+	 * for calculation method see the following:
+	 *	http://www.ti.com/lit/an/sbaa155a/sbaa155a.pdf
+	 *	http://e2e.ti.com/support/other_analog/touch/f/750/t/202636
+	 * */
+	Lcd_Touch_Init();
 
 	while (1) {
 
 		if(xSemaphoreTake(xTouchSemaphore, portMAX_DELAY ) == pdTRUE ) {
 
+			latencyMark(LATENCY_TASK);
 			osDelay(1);
 			if (HAL_GPIO_ReadPin(TOUCH_DI_GPIO_Port, TOUCH_DI_Pin) == GPIO_PIN_RESET) {
 
-				/*
-				 * datasheet: https://ldm-systems.ru/f/doc/catalog/HY-TFT-2,8/XPT2046.pdf
-				 * for calculation method see the following:
-				 *	http://www.ti.com/lit/an/sbaa155a/sbaa155a.pdf
-				 *	http://e2e.ti.com/support/other_analog/touch/f/750/t/202636
-				 * */
+				touch_sample_t sample;
+				static gesture_state_t gesture;	// history too big for the 128 word stack
+				int16_t moveX = 0, moveY = 0;	// drag not taken by the UI yet
 
-				uint16_t x[3], y[3], i;
+				Lcd_Gesture_Reset(&gesture);
 
-				HAL_GPIO_WritePin(TOUCH_nCS_GPIO_Port, TOUCH_nCS_Pin, GPIO_PIN_RESET);
+				// samples until the pen is up, the stream always ends with TOUCH_UP
+				Lcd_Touch_Start();
+				while (Lcd_Touch_Read(&sample, 1000)) {
 
-				if (0) {
-					for (i = 0; i < 3; i++) {
-						pTxData[0] = /* i < 2 ? 0xd7 : */0xd4;
-						HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3,
-								1000);
-						y[i] = (unsigned int) (pRxData[1] << 8) + pRxData[2];
-					}
+					xUIEvent_t event;
+					gesture_t g;
+					uint16_t x = 0, y = 0;
 
-					for (i = 0; i < 3; i++) {
-						pTxData[0] = /* i < 2 ? 0x97 : */0x94;
-						HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3,
-								1000);
-						x[i] = (unsigned int) (pRxData[1] << 8) + pRxData[2];
-					}
-				} else {
-					for (i = 0; i < 3; i++) {
-						pTxData[0] = /* i < 2 ? 0xd7 : */0xd4;
-						HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3,
-								1000);
-						y[i] = (unsigned int) (pRxData[1] << 8) + pRxData[2];
-
-						pTxData[0] = /* i < 2 ? 0x97 : */0x94;
-						HAL_SPI_TransmitReceive(&hspi3, pTxData, pRxData, 3,
-								1000);
-						x[i] = (unsigned int) (pRxData[1] << 8) + pRxData[2];
+					if (sample.state != TOUCH_UP) {
+						Lcd_Translate_Touch_Pos(sample.x, sample.y, &x, &y);
+						xTouchX = sample.x;
+						xTouchY = sample.y;
 					}
-				}
-
-				HAL_GPIO_WritePin(TOUCH_nCS_GPIO_Port, TOUCH_nCS_Pin, GPIO_PIN_SET);
-
-				xUIEvent_t event;
-				event.ucEventID = TOUCH_DOWN_EVENT;
 
-				xTouchX = Lcd_Touch_Get_Closest_Average(x);
-				xTouchY = Lcd_Touch_Get_Closest_Average(y);
-				event.ucData.touchXY = ((unsigned int) xTouchX << 16) + xTouchY;
-				xQueueSendToBack(xUIEventQueue, &event, 1000);
-
-				// TODO: continuous gesture recognition here!
-				osDelay(125); // limit touch event rate
+					if (sample.state == TOUCH_DOWN) {
+						latencyMark(LATENCY_SAMPLE);
+						event.ucEventID = TOUCH_DOWN_EVENT;
+						event.ucData.touchXY = ((unsigned int) xTouchX << 16) + xTouchY;
+						if (xQueueSendToBack(xUIEventQueue, &event, 1000) == pdTRUE)
+							latencyMark(LATENCY_QUEUED);
+					}
 
-			} else {
+					event.ucEventID = INIT_EVENT;
+
+					switch (Lcd_Gesture_Feed(&gesture, sample.time, x, y, sample.state, &g)) {
+					case GESTURE_MOVE:
+						// a busy UI gets the drag summed up in one event
+						moveX += g.dx;
+						moveY += g.dy;
+						event.ucEventID = TOUCH_MOVE_EVENT;
+						event.ucData.vector.x = moveX;
+						event.ucData.vector.y = moveY;
+						if (xQueueSendToBack(xUIEventQueue, &event, 0) == pdTRUE) {
+							latencyMark(LATENCY_QUEUED);
+							moveX = moveY = 0;
+						}
+						event.ucEventID = INIT_EVENT;
+						break;
+
+					case GESTURE_TAP:
+						// only a tap activates what is under the pen, a drag does not
+						if (xTouchX && xTouchY) {
+							event.ucEventID = TOUCH_UP_EVENT;
+							event.ucData.touchXY = ((unsigned int) xTouchX << 16) + xTouchY;
+						}
+						break;
+
+					case GESTURE_LONG_PRESS:
+						event.ucEventID = LONG_PRESS_EVENT;
+						event.ucData.vector.x = g.x;
+						event.ucData.vector.y = g.y;
+						break;
+
+					case GESTURE_SWIPE_LEFT:
+					case GESTURE_SWIPE_RIGHT:
+					case GESTURE_SWIPE_UP:
+					case GESTURE_SWIPE_DOWN:
+					case GESTURE_FLING:
+						// the events are in the order of the gestures
+						event.ucEventID = SWIPE_LEFT_EVENT + (g.type - GESTURE_SWIPE_LEFT);
+						event.ucData.vector.x = g.dx;
+						event.ucData.vector.y = g.dy;
+						break;
+
+					default:
+						break;
+					}
 
-                if (xTouchX && xTouchY) {
-                    xUIEvent_t event;
-                    event.ucEventID = TOUCH_UP_EVENT;
-                    event.ucData.touchXY = ((unsigned int) xTouchX << 16) + xTouchY;
-                    xQueueSendToBack(xUIEventQueue, &event, 1000);
+					if (sample.state == TOUCH_UP && (moveX || moveY)) {
+						xUIEvent_t move = { TOUCH_MOVE_EVENT };
+						move.ucData.vector.x = moveX;
+						move.ucData.vector.y = moveY;
+						if (xQueueSendToBack(xUIEventQueue, &move, 1000) == pdTRUE)
+							latencyMark(LATENCY_QUEUED);
+					}
 
-                    xTouchX = 0;
-                    xTouchY = 0;
+					if (event.ucEventID != INIT_EVENT
+							&& xQueueSendToBack(xUIEventQueue, &event, 1000) == pdTRUE)
+						latencyMark(LATENCY_QUEUED);
 
-                    // TODO: continuous gesture recognition here!
-                    osDelay(125);
-                }
+					if (sample.state == TOUCH_UP) {
+						xTouchX = 0;
+						xTouchY = 0;
+						break;
+					}
+				}
 			}
 		}
 	}
@@ -667,12 +718,24 @@ void StartComm1Task(void const * argument) {
             // osDelay(1);
             static const char m115[] = "M119\n";
 
-            HAL_UART_Transmit(&huart2, m115, /* sizeof(m115)*/ 5, 1000);
+            comm1Transmit((const uint8_t *) m115, /* sizeof(m115)*/ 5);
             osDelay(20);
         }
 	}
 }
 
+HAL_StatusTypeDef comm1Transmit(const uint8_t *pData, uint16_t size) {
+
+	HAL_StatusTypeDef res = HAL_BUSY;
+
+	if (xSemaphoreTake(xComm1TxMutex, 1000) == pdTRUE) {
+		res = HAL_UART_Transmit(&huart2, (uint8_t *) pData, size, 1000);
+		xSemaphoreGive(xComm1TxMutex);
+	}
+
+	return res;
+}
+
 void StartComm2Task(void const * argument) {
 
 	while (1) {
@@ -732,7 +795,9 @@ void StartUITask(void const * argument) {
 
 	xUIEvent_t event;
 	event.ucEventID = INIT_EVENT;
+	uiIconLock();
 	(*processEvent) (&event);
+	uiIconUnlock();
 
 
 	/* Infinite loop */
@@ -743,7 +808,17 @@ void StartUITask(void const * argument) {
 
 			if (xQueueReceive(xUIEventQueue, &event, (TickType_t ) 500)) {
 
+				if (event.ucEventID >= TOUCH_DOWN_EVENT && event.ucEventID <= FLING_EVENT)
+					latencyMark(LATENCY_DEQUEUED);
+
+				uiIconLock();
 				(*processEvent) (&event);
+				uiIconUnlock();
+				latencyEnd();
+#if ICON_CACHE_SIZE
+				if (!uxQueueMessagesWaiting(xUIEventQueue))
+					xSemaphoreGive(xPrefetchSemaphore);	// idle now
+#endif
 			} else {
 				/*
 				 * No events received
@@ -754,6 +829,17 @@ void StartUITask(void const * argument) {
 	/* USER CODE END 5 */
 }
 
+#if ICON_CACHE_SIZE
+/* StartPrefetchTask function, runs only while the UI task waits for events */
+void StartPrefetchTask(void const * argument) {
+
+	for (;;) {
+		if (xSemaphoreTake(xPrefetchSemaphore, portMAX_DELAY) == pdTRUE)
+			uiPrefetch();
+	}
+}
+#endif
+
 /**
   * @brief  This function is executed in case of error occurrence.
   * @param  None
@@ -1,6 +1,7 @@
 
 #include <stdint.h>
 #include "stm32f1xx_hal.h"
+#include "ui.h"
 
 static uint16_t numChars = 0;
 static uint8_t checksum = 0;
@@ -10,11 +11,9 @@ static void rawSendChar(char c);
 static void sendChar(char c);
 static void sendCharAndChecksum(char c);
 
-extern UART_HandleTypeDef huart2;
-
 static void rawSendChar(char c)
 {
-    HAL_UART_Transmit(&huart2, &c, 1, 1000);
+    comm1Transmit((const uint8_t *) &c, 1);
 }
 
 static void sendCharAndChecksum(char c)
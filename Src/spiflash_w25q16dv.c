@@ -191,6 +191,88 @@ HAL_StatusTypeDef readFLASH(uint32_t address, uint8_t* buffer, size_t size) {
 	return res;
 }
 
+HAL_StatusTypeDef beginReadFLASH(uint32_t address) {
+
+	uint8_t cmd[5] = { CMD_READ, (address >> 16) & 0xffu, (address >> 8) & 0xffu,
+			address & 0xffu, 0 };
+
+#if WFLASH_FAST_READ == 1
+	cmd[0] = CMD_FASTREAD;	// one dummy byte after the address
+#endif /* WFLASH_FAST_READ == 1 */
+
+	vTaskSuspendAll();
+	deviceSelect(SPI_FLASH);
+
+	return HAL_SPI_Transmit(&hspi1, cmd, (cmd[0] == CMD_FASTREAD) ? 5 : 4, _IO_TIMEOUT);
+}
+
+HAL_StatusTypeDef continueReadFLASH(uint8_t* buffer, size_t size) {
+
+	return HAL_SPI_Receive(&hspi1, buffer, size, _IO_TIMEOUT);
+}
+
+void endReadFLASH() {
+
+	deviceDeselect();
+	xTaskResumeAll();
+}
+
+#if WFLASH_DMA == 1
+/*
+ * SPI1 RX on DMA1 channel 2, channel 3 clocks a dummy byte out for every
+ * byte in; the HAL handle isn't involved, it stays ready
+ * */
+
+static const uint8_t dmaDummy = 0xff;
+
+HAL_StatusTypeDef startReadFLASH(uint8_t* buffer, size_t size) {
+
+	if (!size || size > 0xffffu || (DMA1_Channel2->CCR & DMA_CCR_EN))
+		return HAL_ERROR;
+
+	__HAL_RCC_DMA1_CLK_ENABLE();
+	(void) SPI1->DR;	// stale byte, if any
+
+	DMA1_Channel2->CCR = 0;
+	DMA1_Channel2->CPAR = (uint32_t) &SPI1->DR;
+	DMA1_Channel2->CMAR = (uint32_t) buffer;
+	DMA1_Channel2->CNDTR = size;
+	DMA1_Channel2->CCR = DMA_CCR_PL_1 | DMA_CCR_MINC | DMA_CCR_EN;
+
+	DMA1_Channel3->CCR = 0;
+	DMA1_Channel3->CPAR = (uint32_t) &SPI1->DR;
+	DMA1_Channel3->CMAR = (uint32_t) &dmaDummy;
+	DMA1_Channel3->CNDTR = size;
+	DMA1_Channel3->CCR = DMA_CCR_DIR | DMA_CCR_EN;
+
+	SPI1->CR2 |= SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN;
+	return HAL_OK;
+}
+
+HAL_StatusTypeDef waitReadFLASH() {
+
+	HAL_StatusTypeDef res = HAL_OK;
+	uint32_t start = HAL_GetTick();
+
+	if (!(DMA1_Channel2->CCR & DMA_CCR_EN))
+		return HAL_OK;
+
+	while (DMA1_Channel2->CNDTR) {
+		if (HAL_GetTick() - start > _IO_TIMEOUT) {
+			res = HAL_TIMEOUT;
+			break;
+		}
+	}
+
+	SPI1->CR2 &= ~(SPI_CR2_RXDMAEN | SPI_CR2_TXDMAEN);
+	DMA1_Channel2->CCR = 0;
+	DMA1_Channel3->CCR = 0;
+	DMA1->IFCR = DMA_IFCR_CGIF2 | DMA_IFCR_CGIF3;
+
+	return res;
+}
+#endif /* WFLASH_DMA == 1 */
+
 static HAL_StatusTypeDef sendFLASHcmd(uint8_t cmd) {
 
 	HAL_StatusTypeDef res = HAL_OK;
@@ -312,6 +394,29 @@ HAL_StatusTypeDef programFLASHPage(uint32_t address, const uint8_t* buffer, uint
 	return res;
 }
 
+static HAL_StatusTypeDef writeFLASHSector(uint32_t address, const uint8_t* buffer) {
+
+	HAL_StatusTypeDef res;
+
+	if ((res = writeEnableFLASH()) == HAL_OK)
+		res = eraseFLASHSector(address);
+
+	for (size_t p = 0;
+			(res == HAL_OK) && p < (WFLASH_SECTOR_SIZE / WFLASH_PAGE_SIZE);
+			p++) {
+
+		if ((res = writeEnableFLASH()) == HAL_OK) {
+
+			res = programFLASHPage(address + p * WFLASH_PAGE_SIZE, buffer,
+					WFLASH_PAGE_SIZE);
+
+			buffer += WFLASH_PAGE_SIZE;
+		}
+	}
+
+	return res;
+}
+
 HAL_StatusTypeDef waitFLASHReady() {
 
 	HAL_StatusTypeDef res = HAL_OK;
@@ -375,7 +480,7 @@ DSTATUS SPIFLASH_status (BYTE lun) {
 
 DRESULT SPIFLASH_read (BYTE lun, BYTE *buff, DWORD sector, UINT count) {
 
-	if (lun || !count)
+	if (lun || !count || sector + count > WFLASH_FAT_SECTORS)
 		return RES_PARERR;
 	if (Stat & STA_NOINIT)
 		return RES_NOTRDY;
@@ -386,7 +491,7 @@ DRESULT SPIFLASH_read (BYTE lun, BYTE *buff, DWORD sector, UINT count) {
 
 DRESULT SPIFLASH_write (BYTE pdrv, const BYTE *buff, DWORD sector, UINT count) {
 
-	if (pdrv || !count)
+	if (pdrv || !count || sector + count > WFLASH_FAT_SECTORS)
 		return RES_PARERR;
 	if (Stat & STA_NOINIT)
 		return RES_NOTRDY;
@@ -397,23 +502,9 @@ DRESULT SPIFLASH_write (BYTE pdrv, const BYTE *buff, DWORD sector, UINT count) {
 
 	while (res == HAL_OK && count) {
 
-		if ((res = writeEnableFLASH()) == HAL_OK)
-			res = eraseFLASHSector(sector * WFLASH_SECTOR_SIZE);
-
-		for (size_t p = 0;
-				(res == HAL_OK) && p < (WFLASH_SECTOR_SIZE / WFLASH_PAGE_SIZE);
-				p++) {
-
-			if ((res = writeEnableFLASH()) == HAL_OK) {
-
-				res = programFLASHPage(
-						sector * WFLASH_SECTOR_SIZE + p * WFLASH_PAGE_SIZE,
-						buff, WFLASH_PAGE_SIZE);
-
-				buff += WFLASH_PAGE_SIZE;
-			}
-		}
+		res = writeFLASHSector(sector * WFLASH_SECTOR_SIZE, buff);
 
+		buff += WFLASH_SECTOR_SIZE;
 		sector++;
 		count--;
 	}
@@ -455,7 +546,7 @@ DRESULT SPIFLASH_ioctl (BYTE drv, BYTE ctrl, void *buff) {
 
 		switch (ctrl) {
 		case GET_SECTOR_COUNT: /* Get number of sectors on the disk (DWORD) */
-			*(DWORD*) buff = 512;
+			*(DWORD*) buff = WFLASH_FAT_SECTORS;
 			res = RES_OK;
 			break;
 
@@ -477,5 +568,158 @@ DRESULT SPIFLASH_ioctl (BYTE drv, BYTE ctrl, void *buff) {
 	return res;
 }
 
+#if WFLASH_ASSET_SECTORS
+
+/*
+ * CRC-32 of size bytes of the asset data; one read command per sector,
+ * task switches stay suspended only that long
+ * */
+
+static uint32_t crcFLASHAssets(uint32_t size) {
+
+	uint8_t buffer[256];
+	uint32_t crc = 0, address = WFLASH_ASSET_DATA;
+	HAL_StatusTypeDef res = HAL_OK;
+
+	while (res == HAL_OK && size) {
+
+		uint32_t sector = (size > WFLASH_SECTOR_SIZE) ? WFLASH_SECTOR_SIZE : size;
+
+		res = beginReadFLASH(address);
+		address += sector;
+		size -= sector;
+
+		while (res == HAL_OK && sector) {
+
+			size_t bytes = (sector > sizeof(buffer)) ? sizeof(buffer) : sector;
+
+			if ((res = continueReadFLASH(buffer, bytes)) == HAL_OK)
+				crc = updateCRC32(crc, buffer, bytes);
+			sector -= bytes;
+		}
+
+		endReadFLASH();
+	}
+
+	return (res == HAL_OK) ? crc : ~crc;
+}
+
+/*
+ * the asset data size if the header is valid, else 0. The CRC is checked
+ * when the assets are installed, before the header is written; at boot a
+ * valid header is enough, reading the whole region took up to a second
+ * */
+
+uint32_t openFLASHAssets() {
+
+	wflash_asset_header_t header;
+
+	if (Stat & STA_NOINIT)
+		return 0;
+
+	if (readFLASH(WFLASH_ASSET_BASE, (uint8_t *) &header, sizeof(header)) != HAL_OK
+			|| memcmp(header.magic, WFLASH_ASSET_MAGIC, sizeof(header.magic))
+			|| !header.size || header.size > WFLASH_ASSET_MAX)
+		return 0;
+
+	return header.size;
+}
+
+/*
+ * the header sector is erased first and written last, after the data has
+ * been read back and checked: an interrupted install leaves no valid region.
+ * A region that already holds the same file (size and CRC) is left alone
+ * */
+
+FRESULT installFLASHAssets(const TCHAR *source) {
+
+	FIL *pFile = NULL;
+	uint8_t *pBuffer = NULL;
+	wflash_asset_header_t header;
+	uint32_t size, crc;
+	FRESULT res = FR_OK;
+
+	if (Stat & STA_NOINIT)
+		return FR_NOT_READY;
+
+	if (FR_OK == crcFile(source, &size, &crc) && openFLASHAssets() == size
+			&& readFLASH(WFLASH_ASSET_BASE, (uint8_t *) &header, sizeof(header)) == HAL_OK
+			&& header.crc == crc && crcFLASHAssets(size) == crc)
+		return FR_OK;
+
+	if (NULL != (pFile = pvPortMalloc(sizeof(FIL))) &&
+			NULL != (pBuffer = pvPortMalloc(WFLASH_SECTOR_SIZE))) {
+
+		if (FR_OK == (res = f_open(pFile, source, FA_READ))) {
+
+			uint32_t address = WFLASH_ASSET_DATA;
+			size_t bytes;
+
+			memcpy(header.magic, WFLASH_ASSET_MAGIC, sizeof(header.magic));
+			header.size = f_size(pFile);
+			header.crc = 0;
+			header.reserved = 0;
+
+			if (!header.size || header.size > WFLASH_ASSET_MAX)
+				res = FR_DENIED;
+			else if (writeEnableFLASH() != HAL_OK
+					|| eraseFLASHSector(WFLASH_ASSET_BASE) != HAL_OK)
+				res = FR_DISK_ERR;
+
+			while (FR_OK == res
+					&& FR_OK == (res = f_read(pFile, pBuffer, WFLASH_SECTOR_SIZE, &bytes))
+					&& bytes) {
+
+				header.crc = updateCRC32(header.crc, pBuffer, bytes);
+				memset(pBuffer + bytes, 0xff, WFLASH_SECTOR_SIZE - bytes);
+
+				if (writeFLASHSector(address, pBuffer) != HAL_OK)
+					res = FR_DISK_ERR;
+				address += WFLASH_SECTOR_SIZE;
+			}
+
+			if (FR_OK == res && crcFLASHAssets(header.size) != header.crc)
+				res = FR_DISK_ERR;
+
+			if (FR_OK == res && (writeEnableFLASH() != HAL_OK
+					|| programFLASHPage(WFLASH_ASSET_BASE, (const uint8_t *) &header,
+							sizeof(header)) != HAL_OK))
+				res = FR_DISK_ERR;
+
+			f_close(pFile);
+		}
+
+	} else {
+		res = FR_NOT_ENOUGH_CORE;
+	}
+
+	if (pBuffer) vPortFree(pBuffer);
+	if (pFile) vPortFree(pFile);
+
+	return res;
+}
+
+/* erases the header sector, the region is empty until the next install */
+
+FRESULT removeFLASHAssets() {
+
+	wflash_asset_header_t header;
+
+	if (Stat & STA_NOINIT)
+		return FR_NOT_READY;
+
+	if (readFLASH(WFLASH_ASSET_BASE, (uint8_t *) &header, sizeof(header)) != HAL_OK)
+		return FR_DISK_ERR;
+	if (memcmp(header.magic, WFLASH_ASSET_MAGIC, sizeof(header.magic)))
+		return FR_OK;		// nothing installed
+
+	if (writeEnableFLASH() != HAL_OK || eraseFLASHSector(WFLASH_ASSET_BASE) != HAL_OK)
+		return FR_DISK_ERR;
+
+	return FR_OK;
+}
+
+#endif /* WFLASH_ASSET_SECTORS */
+
 /************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
 
@@ -37,6 +37,7 @@
 #include "cmsis_os.h"
 
 /* USER CODE BEGIN 0 */
+#include "lcd.h"
 
 /* USER CODE END 0 */
 
@@ -307,5 +308,31 @@ void OTG_FS_IRQHandler(void)
 
 /* USER CODE BEGIN 1 */
 
+#if LCD_PUMP
+/**
+* @brief This function handles TIM1 update interrupt (LCD pixel pump).
+*/
+void TIM1_UP_IRQHandler(void)
+{
+  Lcd_Pump_IRQHandler();
+}
+#endif
+
+/**
+* @brief This function handles TIM6 global interrupt (touch sampler pace).
+*/
+void TIM6_IRQHandler(void)
+{
+  Lcd_Touch_Timer_IRQHandler();
+}
+
+/**
+* @brief This function handles DMA2 channel1 global interrupt (touch sampler frame).
+*/
+void DMA2_Channel1_IRQHandler(void)
+{
+  Lcd_Touch_DMA_IRQHandler();
+}
+
 /* USER CODE END 1 */
 /************************ (C) COPYRIGHT STMicroelectronics *****END OF FILE****/
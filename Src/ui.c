@@ -31,21 +31,29 @@
   ******************************************************************************
   */
 
+#include <stdlib.h>
 #include <string.h>
 
 #include "ui.h"
 #include "lcd.h"
+#include "ui_widget.h"
+#include "ui_icon.h"
 #include "fatfs.h"
 #include "eeprom.h"
+#include "latency.h"
 
 static FATFS flashFileSystem;	// 0:/
 static FATFS sdFileSystem;		// 1:/
 static FATFS usbFileSystem;		// 2:/
 
 extern TIM_HandleTypeDef htim2;
+#if LATENCY_TRACE
+extern UART_HandleTypeDef huart3;
+#endif
 
 #define MKS_PIC_SD	"1:/mks_pic"
 #define MKS_PIC_FL	"0:/mks_pic"
+#define MKS_PIC_LIST	MKS_PIC_FL ".lst"	// manifest of the synced files
 
 #define READY_PRINT	"MyFirmware"
 
@@ -99,6 +107,10 @@ void uiSetupConnect250000(xUIEvent_t *pxEvent);
 
 void uiSetupWifi  (xUIEvent_t *pxEvent);
 void uiSetupAbout (xUIEvent_t *pxEvent);
+void uiSetupCalibrate(xUIEvent_t *pxEvent);
+#if LATENCY_TRACE
+void uiSetupLatency(xUIEvent_t *pxEvent);
+#endif
 
 void uiMoreMenu   (xUIEvent_t *pxEvent);
 void uiFileBrowse (xUIEvent_t *pxEvent);
@@ -111,11 +123,9 @@ eventProcessor_t processEvent = uiInitialize;
  */
 
 static void uiMediaStateChange(uint16_t event);
+static void uiTouchCalLoad(void);
 static void uiRedrawFileList(int raw_x, int raw_y);
-static void uiDrawProgressBar(uint32_t scale, uint16_t color);
-static void uiUpdateProgressBar(uint32_t progress);
-static void uiDrawBinIcon(const TCHAR *path, uint16_t x, uint16_t y,
-		uint16_t width, uint16_t height, uint8_t resetWindow);
+static void uiDrawFileList(uint16_t y1, uint16_t y2);
 
 
 __STATIC_INLINE void uiNextState(void (*volatile next) (xUIEvent_t *pxEvent)) {
@@ -128,6 +138,7 @@ __STATIC_INLINE void uiShortBeep() {
 	HAL_TIM_OC_Start_IT(&htim2, TIM_CHANNEL_3);
 	osDelay(12);
 	HAL_TIM_OC_Stop_IT(&htim2, TIM_CHANNEL_3);
+	latencyMark(LATENCY_BEEP);
 }
 
 typedef struct {
@@ -136,21 +147,50 @@ typedef struct {
 	const eventProcessor_t	pEventProcessor;
 } xMenuItem_t;
 
+#if ICON_CACHE_SIZE
+static void uiMenuChosen(const xMenuItem_t *pMenu, eventProcessor_t processor);
+#endif /* ICON_CACHE_SIZE */
+
+static xWidget_t *pMenuTitle = NULL;
+
 __STATIC_INLINE void uiDrawMenu(const xMenuItem_t *pMenu) {
 
 	if (pMenu) {
-		uiDrawBinIcon(pMenu[0].pIconFile,	1, 16, 78, 104, 0);
-		uiDrawBinIcon(pMenu[1].pIconFile,  81, 16, 78, 104, 0);
-		uiDrawBinIcon(pMenu[2].pIconFile, 161, 16, 78, 104, 0);
-		uiDrawBinIcon(pMenu[3].pIconFile, 241, 16, 78, 104, 0);
-
-		uiDrawBinIcon(pMenu[4].pIconFile,	1, 18 + 104, 78, 104, 0);
-		uiDrawBinIcon(pMenu[5].pIconFile,  81, 18 + 104, 78, 104, 0);
-		uiDrawBinIcon(pMenu[6].pIconFile, 161, 18 + 104, 78, 104, 0);
-		uiDrawBinIcon(pMenu[7].pIconFile, 241, 18 + 104, 78, 104, 1);
+		// icons that did not change since the previous menu are not redrawn
+		uiWidgetBegin(Lcd_Get_RGB565(0, 0, 0));
+		pMenuTitle = uiWidgetLabel(0, 0, LCD_MAX_X, 16, "", 0xffffu);
+
+		uiWidgetIcon(  1, 16, 78, 104, pMenu[0].pIconFile);
+		uiWidgetIcon( 81, 16, 78, 104, pMenu[1].pIconFile);
+		uiWidgetIcon(161, 16, 78, 104, pMenu[2].pIconFile);
+		uiWidgetIcon(241, 16, 78, 104, pMenu[3].pIconFile);
+
+		uiWidgetIcon(  1, 18 + 104, 78, 104, pMenu[4].pIconFile);
+		uiWidgetIcon( 81, 18 + 104, 78, 104, pMenu[5].pIconFile);
+		uiWidgetIcon(161, 18 + 104, 78, 104, pMenu[6].pIconFile);
+		uiWidgetIcon(241, 18 + 104, 78, 104, pMenu[7].pIconFile);
+		uiWidgetEnd();
 	}
 }
 
+static void uiMenuTitle(const char *title) {
+
+#if LCD_BENCHMARK
+	// the first title of a menu paints its icons, the time goes next to it
+	char buffer[WIDGET_TEXTLEN + 1];
+	uint32_t start = HAL_GetTick();
+
+	uiWidgetSetText(pMenuTitle, title);
+	uiWidgetRedraw();
+
+	snprintf(buffer, sizeof(buffer), "%-34.34s%4lums", title, HAL_GetTick() - start);
+	uiWidgetSetText(pMenuTitle, buffer);
+#else
+	uiWidgetSetText(pMenuTitle, title);
+#endif /* LCD_BENCHMARK */
+	uiWidgetRedraw();
+}
+
 static uint16_t touchX, touchY;
 
 __STATIC_INLINE void uiMenuHandleEventDefault(const xMenuItem_t *pMenu, xUIEvent_t *pxEvent) {
@@ -165,13 +205,17 @@ __STATIC_INLINE void uiMenuHandleEventDefault(const xMenuItem_t *pMenu, xUIEvent
 			break;
 
         case SHOW_STATUS:
-            Lcd_Fill_Rect(0, LCD_MAX_Y - 9, LCD_MAX_X, LCD_MAX_Y, 0);
-            Lcd_Put_Text(10, LCD_MAX_Y - 9, 8, statString, 0xffffu);
+            {
+                // pad to the line end, opaque cells overwrite the old status
+                char buffer[MAXTEXTLEN + 1];
+                snprintf(buffer, sizeof(buffer), "%-*.*s", MAXTEXTLEN, MAXTEXTLEN,
+                        (char *)statString);
+                Lcd_Put_Text_Opaque(10, LCD_MAX_Y - 9, 8, buffer, 0xffffu, 0);
+            }
             break;
 
 		case INIT_EVENT:
 			if (pMenu) {
-				Lcd_Fill_Screen(Lcd_Get_RGB565(0, 0, 0));
 				uiDrawMenu(pMenu);
 #if 0
 				char buffer[12];
@@ -202,31 +246,15 @@ __STATIC_INLINE void uiMenuHandleEventDefault(const xMenuItem_t *pMenu, xUIEvent
 				} else if (touchY >= 16 + 104 && touchY <= 16 + 104 + 80) {
 					p = pMenu[4 + (touchX - 1) / 80].pEventProcessor;
 				}
-				if (p) uiNextState(p);
+				if (p) {
+#if ICON_CACHE_SIZE
+					uiMenuChosen(pMenu, p);
+#endif /* ICON_CACHE_SIZE */
+					uiNextState(p);
+				}
 			}
 			break;
 
-		case UPDATE1_EVENT: uiDrawBinIcon(pMenu[0].pIconFile,	1, 16, 78, 104, 1); break;
-		case UPDATE2_EVENT: uiDrawBinIcon(pMenu[1].pIconFile,  81, 16, 78, 104, 1); break;
-		case UPDATE3_EVENT: uiDrawBinIcon(pMenu[2].pIconFile, 161, 16, 78, 104, 1); break;
-		case UPDATE4_EVENT: uiDrawBinIcon(pMenu[3].pIconFile, 241, 16, 78, 104, 1); break;
-		case UPDATE5_EVENT: uiDrawBinIcon(pMenu[4].pIconFile,	1, 18 + 104, 78, 104, 1); break;
-		case UPDATE6_EVENT: uiDrawBinIcon(pMenu[5].pIconFile,  81, 18 + 104, 78, 104, 1); break;
-		case UPDATE7_EVENT: uiDrawBinIcon(pMenu[6].pIconFile, 161, 18 + 104, 78, 104, 1); break;
-		case UPDATE8_EVENT: uiDrawBinIcon(pMenu[7].pIconFile, 241, 18 + 104, 78, 104, 1); break;
-
-		case UPDATE12_EVENT:
-			uiDrawBinIcon(pMenu[0].pIconFile,	1, 16, 78, 104, 0);
-			uiDrawBinIcon(pMenu[1].pIconFile,  81, 16, 78, 104, 1);
-			break;
-
-		case UPDATE14_EVENT:
-			uiDrawBinIcon(pMenu[0].pIconFile,	1, 16, 78, 104, 0);
-			uiDrawBinIcon(pMenu[1].pIconFile,  81, 16, 78, 104, 0);
-			uiDrawBinIcon(pMenu[2].pIconFile, 161, 16, 78, 104, 0);
-			uiDrawBinIcon(pMenu[3].pIconFile, 241, 16, 78, 104, 1);
-			break;
-
 		default:
 			break;
 		}
@@ -244,6 +272,7 @@ void uiInitialize (xUIEvent_t *pxEvent) {
 		DIR dir;
 
 		Lcd_Init(LCD_LANDSCAPE_CL);
+		uiTouchCalLoad();
 		Lcd_Fill_Screen(Lcd_Get_RGB565(0, 0, 0));
 
 		// mount internal flash, format if needed
@@ -253,17 +282,25 @@ void uiInitialize (xUIEvent_t *pxEvent) {
 		if (sdFileSystem.fs_type && FR_OK == f_opendir(&dir, MKS_PIC_SD)) {
 
 			FRESULT res = FR_OK; /* Open the directory */
-			BYTE *work = pvPortMalloc(_MAX_SS);
-			if (work) {
+			sync_t sync;
+
+			// no volume yet, or one made before the asset region was carved out
+			if (!flashFileSystem.fs_type || flashFileSystem.database
+					+ (flashFileSystem.n_fatent - 2) * flashFileSystem.csize > WFLASH_FAT_SECTORS) {
+
+				BYTE *work = pvPortMalloc(_MAX_SS);
+				if (work) {
 
-				f_mkfs ("0:", FM_ANY, 0, work, _MAX_SS);	/* Create a FAT volume */
-				vPortFree(work);
+					f_mkfs ("0:", FM_ANY, 0, work, _MAX_SS);	/* Create a FAT volume */
+					vPortFree(work);
 
-				f_mount(&flashFileSystem, SPIFL_Path, 1);
+					f_mount(&flashFileSystem, SPIFL_Path, 1);
+				}
 			}
 
 			res = f_mkdir(MKS_PIC_FL);
-			if (res == FR_OK || res == FR_EXIST) {
+			if ((res == FR_OK || res == FR_EXIST)
+					&& FR_OK == (res = beginSync(&sync, MKS_PIC_LIST))) {
 
 				FILINFO fno;
 				size_t count = 0;
@@ -275,10 +312,14 @@ void uiInitialize (xUIEvent_t *pxEvent) {
 				f_rewinddir(&dir);
 				if (count) {
 
-					Lcd_Put_Text(56, 80, 16, "Copying files to FLASH...", Lcd_Get_RGB565(0, 63, 0));
-					uiDrawProgressBar(count, Lcd_Get_RGB565(0, 63, 0));
+					uint16_t green = Lcd_Get_RGB565(0, 63, 0);
 
-					// TODO: format flash again?
+					uiWidgetBegin(Lcd_Get_RGB565(0, 0, 0));
+					uiWidgetLabel(56, 80, 25 * 8, 16, "Syncing files to FLASH...", green);
+					xWidget_t *pBar = uiWidgetProgress(8, 98, 305, 45, count, green);
+					xWidget_t *pFile = uiWidgetLabel(0, 232, 38 * 8, 8, "", green);
+					xWidget_t *pResult = uiWidgetLabel(304, 232, 16, 8, "", green);
+					uiWidgetEnd();
 
 					count = 0;
 					res = FR_OK;
@@ -288,56 +329,82 @@ void uiInitialize (xUIEvent_t *pxEvent) {
 
 							char src[50];
 							char dst[50];
+							uint8_t copied = 0;
 
-							Lcd_Fill_Rect(0, 232, 319, 240, 0);
 							snprintf(src, sizeof(src), "%02u", res);
-							Lcd_Put_Text(304, 232, 8, src,
-									res == FR_OK ? Lcd_Get_RGB565(0, 63, 0) : Lcd_Get_RGB565(31, 0, 0));
+							uiWidgetSetText(pResult, src);
+							pResult->color = (res == FR_OK) ? green : Lcd_Get_RGB565(31, 0, 0);
 
 							snprintf(src, sizeof(src), MKS_PIC_SD "/%s", fno.fname);
 							snprintf(dst, sizeof(dst), MKS_PIC_FL "/%s", fno.fname);
 
-							Lcd_Put_Text(0, 232, 8, src, Lcd_Get_RGB565(0, 63, 0));
-							res = transferFile(src, dst, 1);
+							uiWidgetSetText(pFile, src);
+							uiWidgetRedraw();
+							res = syncFile(&sync, src, dst, &copied);
 
-							uiUpdateProgressBar(++count);
+							uiWidgetSetValue(pBar, ++count);
+							uiWidgetRedraw();
 						}
 					}
+				}
 
-					Lcd_Fill_Screen(Lcd_Get_RGB565(0, 0, 0));
+				// the icon pack, if there is one, goes along with the icons
+				if (FR_OK == f_stat(MKS_PIC_SD ".pak", &fno)) {
+#if WFLASH_ASSET_SECTORS
+					if (FR_OK != installFLASHAssets(MKS_PIC_SD ".pak"))
+						sync.failed++;
+#else
+					uint8_t copied = 0;
+					syncFile(&sync, MKS_PIC_SD ".pak", MKS_PIC_FL ".pak", &copied);
+#endif /* WFLASH_ASSET_SECTORS */
+
+				} else if (count) {
+					// a new icon set without a pack, the old pack is drawn first and would hide it
+#if WFLASH_ASSET_SECTORS
+					if (FR_OK != removeFLASHAssets())
+						sync.failed++;
+#endif /* WFLASH_ASSET_SECTORS */
+					res = f_unlink(MKS_PIC_FL ".pak");
+					if (FR_OK != res && FR_NO_FILE != res)
+						sync.failed++;
 				}
+
+				// done only when everything is in place, else resumed on the next boot
+				res = endSync(&sync);
 			}
 
 			f_closedir(&dir);
-			f_rename(MKS_PIC_SD, MKS_PIC_SD ".old");
+			if (FR_OK == res)
+				f_rename(MKS_PIC_SD, MKS_PIC_SD ".old");
 		}
 
+		uiIconPackOpen();
 		uiNextState(uiMainMenu);
 	} else
 		uiMenuHandleEventDefault(NULL, pxEvent);
 }
 
-void uiMainMenu (xUIEvent_t *pxEvent) {
+static const xMenuItem_t mainMenu[8] = {
+	{ MKS_PIC_FL "/bmp_preHeat.bin", uiPreheatMenu },
+	{ MKS_PIC_FL "/bmp_mov.bin", uiMoveMenu },
+	{ MKS_PIC_FL "/bmp_zero.bin", uiHomeMenu },
+	{ MKS_PIC_FL "/bmp_printing.bin", uiFileBrowse },
+	{ MKS_PIC_FL "/bmp_extruct.bin", uiExtrudeMenu },
+	{ MKS_PIC_FL "/bmp_fan.bin", uiFanMenu },
+	{ MKS_PIC_FL "/bmp_set.bin", uiSetupMenu },
+	{ MKS_PIC_FL "/bmp_More.bin", uiMoreMenu }
+};
 
-	static const xMenuItem_t mainMenu[8] = {
-		{ MKS_PIC_FL "/bmp_preHeat.bin", uiPreheatMenu },
-		{ MKS_PIC_FL "/bmp_mov.bin", uiMoveMenu },
-		{ MKS_PIC_FL "/bmp_zero.bin", uiHomeMenu },
-		{ MKS_PIC_FL "/bmp_printing.bin", uiFileBrowse },
-		{ MKS_PIC_FL "/bmp_extruct.bin", uiExtrudeMenu },
-		{ MKS_PIC_FL "/bmp_fan.bin", uiFanMenu },
-		{ MKS_PIC_FL "/bmp_set.bin", uiSetupMenu },
-		{ MKS_PIC_FL "/bmp_More.bin", uiMoreMenu }
-	};
+void uiMainMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(mainMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT, 0xffffu);
+		uiMenuTitle(READY_PRINT);
 }
 
 static xMenuItem_t setupMenu[8] = {
 	{ MKS_PIC_FL "/bmp_fileSys.bin", uiSetupFilesystemMenu },
-	{ MKS_PIC_FL "/bmp_adj.bin", NULL },
+	{ MKS_PIC_FL "/bmp_adj.bin", uiSetupCalibrate },
 	{ MKS_PIC_FL "/bmp_wifi.bin", uiSetupWifi },
 	{ MKS_PIC_FL "/bmp_connect.bin", uiSetupConnectMenu },
 	{ MKS_PIC_FL "/bmp_about.bin", uiSetupAbout },
@@ -360,7 +427,7 @@ void uiSetupMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(setupMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Set");
 }
 
 void uiSetupMenuOffMode(xUIEvent_t *pxEvent) {
@@ -376,10 +443,136 @@ void uiSetupMenuOffMode(xUIEvent_t *pxEvent) {
 			break;
 		}
 	}
+	uiNextState(uiSetupMenu);
+}
 
-	processEvent = uiSetupMenu;
-	xUIEvent_t event = { UPDATE7_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+/*
+ * touch calibration: a cross per point, LCD_TOUCH_CAL_INSET from the
+ * corners and one in the middle. A fit that misses a target by more than
+ * CAL_ERROR_MAX is a bad tap and starts over; a good one is applied and
+ * saved to the EEPROM, uiInitialize() loads it
+ * */
+
+#define CAL_MAGIC		0x4c43	// "CL"
+#define CAL_ERROR_MAX	8		// px
+
+typedef struct {
+	uint16_t	magic;
+	uint16_t	sum;			// of the bytes of cal
+	touch_cal_t	cal;
+} xTouchCalRecord_t;
+
+static touch_point_t calRaw[LCD_TOUCH_CAL_POINTS];
+static uint8_t calPoint = 0;
+
+static uint16_t uiTouchCalSum(const touch_cal_t *cal) {
+
+	const uint8_t *p = (const uint8_t *) cal;
+	uint16_t sum = 0;
+
+	for (size_t i = 0; i < sizeof(*cal); i++)
+		sum += p[i];
+	return sum;
+}
+
+static void uiTouchCalLoad(void) {
+
+	xTouchCalRecord_t record;
+
+	if (HAL_OK == readEEPROM(EEPROM_TOUCH_CAL, (uint8_t *) &record, sizeof(record))
+			&& record.magic == CAL_MAGIC && record.sum == uiTouchCalSum(&record.cal))
+		Lcd_Touch_Set_Calibration(&record.cal);
+}
+
+static HAL_StatusTypeDef uiTouchCalSave(const touch_cal_t *cal) {
+
+	xTouchCalRecord_t record;
+
+	memset(&record, 0, sizeof(record));		// padding too, it is summed up
+	record.magic = CAL_MAGIC;
+	record.cal = *cal;
+	record.sum = uiTouchCalSum(&record.cal);
+	return writeEEPROM(EEPROM_TOUCH_CAL, (uint8_t *) &record, sizeof(record));
+}
+
+static void uiCalibrateTarget(uint8_t point, touch_point_t *target) {
+
+	uint16_t left = LCD_TOUCH_CAL_INSET, right = LCD_MAX_X - LCD_TOUCH_CAL_INSET;
+	uint16_t top = LCD_TOUCH_CAL_INSET, bottom = LCD_MAX_Y - LCD_TOUCH_CAL_INSET;
+
+	target->x = (point == 0 || point == 3) ? left : (point < 3) ? right : LCD_MAX_X / 2;
+	target->y = (point < 2) ? top : (point < 4) ? bottom : LCD_MAX_Y / 2;
+}
+
+static void uiCalibrateDraw(char *text) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>Touch", 0xffffu);
+	Lcd_Put_Text(0, LCD_MAX_Y - 9, 8, text, 0xffffu);
+
+	if (calPoint < LCD_TOUCH_CAL_POINTS) {
+		touch_point_t t;
+		uint16_t red = Lcd_Get_RGB565(31, 0, 0);
+
+		uiCalibrateTarget(calPoint, &t);
+		Lcd_Line(t.x - 12, t.y, t.x + 12, t.y, 0xffffu);
+		Lcd_Line(t.x, t.y - 12, t.x, t.y + 12, 0xffffu);
+		Lcd_Circle(t.x, t.y, 6, red);
+	}
+}
+
+void uiSetupCalibrate(xUIEvent_t *pxEvent) {
+
+	touch_point_t targets[LCD_TOUCH_CAL_POINTS];
+	touch_cal_t cal;
+	uint8_t i;
+
+	switch (pxEvent->ucEventID) {
+	case INIT_EVENT:
+		uiWidgetInvalidate();	// the screen is painted here
+		calPoint = 0;
+		uiCalibrateDraw("Tap the center of each cross");
+		break;
+
+	case TOUCH_UP_EVENT:
+		uiShortBeep();
+		if (calPoint >= LCD_TOUCH_CAL_POINTS) {
+			uiNextState(uiSetupMenu);
+			break;
+		}
+
+		calRaw[calPoint].x = (pxEvent->ucData.touchXY) >> 16 & 0x7fffu;
+		calRaw[calPoint].y = pxEvent->ucData.touchXY & 0x7fffu;
+		if (++calPoint < LCD_TOUCH_CAL_POINTS) {
+			uiCalibrateDraw("Tap the center of each cross");
+			break;
+		}
+
+		for (i = 0; i < LCD_TOUCH_CAL_POINTS; i++)
+			uiCalibrateTarget(i, &targets[i]);
+
+		uint8_t ok = Lcd_Touch_Calibrate(calRaw, targets, LCD_TOUCH_CAL_POINTS, &cal);
+		for (i = 0; ok && i < LCD_TOUCH_CAL_POINTS; i++) {
+			int16_t x, y;
+			Lcd_Touch_Map(&cal, calRaw[i].x, calRaw[i].y, &x, &y);
+			ok = abs(x - targets[i].x) <= CAL_ERROR_MAX && abs(y - targets[i].y) <= CAL_ERROR_MAX;
+		}
+
+		if (!ok) {
+			calPoint = 0;
+			uiCalibrateDraw("Taps do not fit, once more: tap the crosses");
+			break;
+		}
+
+		Lcd_Touch_Set_Calibration(&cal);
+		uiCalibrateDraw((HAL_OK == uiTouchCalSave(&cal))
+				? "Calibration saved, tap to return" : "EEPROM write failed, tap to return");
+		break;
+
+	default:
+		uiMenuHandleEventDefault(NULL, pxEvent);
+		break;
+	}
 }
 
 static xMenuItem_t setupFilesystemMenu[8] = {
@@ -409,27 +602,21 @@ void uiSetupFilesystemMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(setupFilesystemMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>Filesystem", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Set>Filesystem");
 }
 
 void uiSetupFilesystemSD (xUIEvent_t *pxEvent) {
     if (INIT_EVENT == pxEvent->ucEventID) {
         selectedFs = FS_SD;
     }
-
-    processEvent = uiSetupFilesystemMenu;
-	xUIEvent_t event = { UPDATE12_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupFilesystemMenu);
 }
 
 void uiSetupFilesystemUSB (xUIEvent_t *pxEvent) {
     if (INIT_EVENT == pxEvent->ucEventID) {
         selectedFs = FS_USB;
     }
-
-    processEvent = uiSetupFilesystemMenu;
-    xUIEvent_t event = { UPDATE12_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupFilesystemMenu);
 }
 
 static xMenuItem_t setupConnectMenu[8] = {
@@ -464,107 +651,238 @@ void uiSetupConnectMenu(xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(setupConnectMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>ConnectSpeed", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Set>ConnectSpeed");
 }
 
 void uiSetupConnect9600(xUIEvent_t *pxEvent) {
 	connectSpeed = CONNECT_9600;
-	processEvent = uiSetupConnectMenu;
-	xUIEvent_t event = { UPDATE14_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupConnectMenu);
 }
 
 void uiSetupConnect57600(xUIEvent_t *pxEvent) {
 	connectSpeed = CONNECT_57600;
-	processEvent = uiSetupConnectMenu;
-	xUIEvent_t event = { UPDATE14_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupConnectMenu);
 }
 
 void uiSetupConnect115200(xUIEvent_t *pxEvent) {
 	connectSpeed = CONNECT_115200;
-	processEvent = uiSetupConnectMenu;
-	xUIEvent_t event = { UPDATE14_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupConnectMenu);
 }
 
 void uiSetupConnect250000(xUIEvent_t *pxEvent) {
 	connectSpeed = CONNECT_250000;
-	processEvent = uiSetupConnectMenu;
-	xUIEvent_t event = { UPDATE14_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiSetupConnectMenu);
 }
 
-void uiSetupWifi (xUIEvent_t *pxEvent) {
+static const xMenuItem_t setupWifiMenu[8] = {
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ MKS_PIC_FL "/bmp_return.bin", uiSetupMenu }
+};
 
-	static const xMenuItem_t setupWifiMenu[8] = {
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ MKS_PIC_FL "/bmp_return.bin", uiSetupMenu }
-	};
+void uiSetupWifi (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(setupWifiMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>Wifi", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Set>Wifi");
 }
 
+static const xMenuItem_t setupAboutMenu[8] = {
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ NULL, NULL },
+	{ MKS_PIC_FL "/bmp_return.bin", uiSetupMenu }
+};
+
 void uiSetupAbout(xUIEvent_t *pxEvent) {
 
-	static const xMenuItem_t setupAboutMenu[8] = {
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ NULL, NULL },
-		{ MKS_PIC_FL "/bmp_return.bin", uiSetupMenu }
+#if LATENCY_TRACE
+	if (LONG_PRESS_EVENT == pxEvent->ucEventID) {
+		uiNextState(uiSetupLatency);
+		return;
+	}
+#endif /* LATENCY_TRACE */
+
+#if LCD_BENCHMARK
+	static const char *const benchIcons[8] = {
+		MKS_PIC_FL "/bmp_preHeat.bin", MKS_PIC_FL "/bmp_mov.bin",
+		MKS_PIC_FL "/bmp_zero.bin", MKS_PIC_FL "/bmp_printing.bin",
+		MKS_PIC_FL "/bmp_extruct.bin", MKS_PIC_FL "/bmp_fan.bin",
+		MKS_PIC_FL "/bmp_set.bin", MKS_PIC_FL "/bmp_More.bin"
 	};
+	lcd_benchmark_t bench;
+	xIconBenchmark_t iconBench;
+
+	if (INIT_EVENT == pxEvent->ucEventID) {
+		uiIconBenchmark(benchIcons, 8, &iconBench);		// the main menu icons
+		Lcd_Benchmark(&bench);
+		uiWidgetInvalidate();	// the menu repaints every cell over the test pattern
+	}
+#endif /* LCD_BENCHMARK */
 
 	uiMenuHandleEventDefault(setupAboutMenu, pxEvent);
-	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>About", 0xffffu);
+	if (INIT_EVENT == pxEvent->ucEventID) {
+		uiMenuTitle(READY_PRINT ">Set>About");
+
+#if LCD_BENCHMARK
+		char buffer[MAXSTATSIZE + 1];
+
+		snprintf(buffer, sizeof(buffer), "Controller: %s", Lcd_Controller());
+		Lcd_Put_Text(0, 14, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "Set_Data:   %7lu px/s", bench.setData);
+		Lcd_Put_Text(0, 24, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "Stream fill:%7lu px/s", bench.streamFill);
+		Lcd_Put_Text(0, 34, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "Stream data:%7lu px/s", bench.streamPixels);
+		Lcd_Put_Text(0, 44, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "Main menu:  file %4lu ms, pack %4lu ms",
+				iconBench.fileTicks, iconBench.packTicks);
+		Lcd_Put_Text(0, 74, 8, buffer, 0xffffu);
+#if ICON_CACHE_SIZE
+		xIconCacheStats_t cache;
+
+		uiIconCacheStats(&cache);
+		snprintf(buffer, sizeof(buffer), "Icon cache: %5lu hit %5lu miss %4lu KB",
+				cache.hits, cache.misses, cache.bytesSaved >> 10);
+		Lcd_Put_Text(0, 84, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "            %5u icons %3u read ahead",
+				cache.icons, cache.prefetched);
+		Lcd_Put_Text(0, 94, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "            %5lu too large (raw/8 bpp)",
+				cache.tooLarge);
+		Lcd_Put_Text(0, 104, 8, buffer, 0xffffu);
+#endif /* ICON_CACHE_SIZE */
+#if LCD_PUMP
+		snprintf(buffer, sizeof(buffer), "Pump fill:  %7lu px/s %3lu%% free",
+				bench.pumpFill, bench.pumpCpuFree);
+		Lcd_Put_Text(0, 54, 8, buffer, 0xffffu);
+		snprintf(buffer, sizeof(buffer), "Pump data:  %7lu px/s", bench.pumpPixels);
+		Lcd_Put_Text(0, 64, 8, buffer, 0xffffu);
+#endif
+		uiWidgetInvalidate();	// drawn over the empty icon cells
+#endif /* LCD_BENCHMARK */
+	}
 }
 
-void uiHomeMenu (xUIEvent_t *pxEvent) {
+#if LATENCY_TRACE
+/*
+ * touch latency table, see latency.h; [dump] sends it to USART3 as
+ * G-code comments, so a host on the printer port would skip it as well
+ * */
 
-	static const xMenuItem_t homeMenu[8] = {
-			{ MKS_PIC_FL "/bmp_zeroA.bin", NULL },
-			{ MKS_PIC_FL "/bmp_zeroX.bin", NULL },
-			{ MKS_PIC_FL "/bmp_zeroY.bin", NULL },
-			{ MKS_PIC_FL "/bmp_zeroZ.bin", NULL },
-			{ NULL, NULL },
-			{ NULL, NULL },
-			{ NULL, NULL },
-			{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
-	};
+static void uiLatencyDraw(char *status) {
+
+	char line[LATENCY_LINE];
+	int row;
+
+	for (row = -1; row < LATENCY_ROWS; row++) {
+		latencyFormat(row, line, sizeof(line));
+		snprintf(line + strlen(line), sizeof(line) - strlen(line), "%*s",
+				(int) (sizeof(line) - 1 - strlen(line)), "");
+		Lcd_Put_Text_Opaque(0, 30 + 10 * row, 8, line, 0xffffu, 0);
+	}
+
+	snprintf(line, sizeof(line), "%-40.40s", status);
+	Lcd_Put_Text_Opaque(0, LCD_MAX_Y - 9, 8, line, 0xffffu, 0);
+}
+
+static void uiLatencyDump(void) {
+
+	char line[LATENCY_LINE + 3];
+	int row;
+
+	for (row = -1; row < LATENCY_ROWS; row++) {
+		line[0] = ';';
+		line[1] = ' ';
+		latencyFormat(row, line + 2, LATENCY_LINE);
+		strcat(line, "\n");
+		HAL_UART_Transmit(&huart3, (uint8_t *) line, strlen(line), 100);
+	}
+}
+
+void uiSetupLatency(xUIEvent_t *pxEvent) {
+
+	uint16_t x, y;
+
+	switch (pxEvent->ucEventID) {
+	case INIT_EVENT:
+		uiWidgetInvalidate();	// the screen is painted here
+		Lcd_Fill_Screen(0);
+		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Set>About>Latency", 0xffffu);
+		Lcd_Put_Text(16, LCD_MAX_Y - 32, 8, "[dump]", 0xffffu);
+		Lcd_Put_Text(LCD_MAX_X / 2 - 28, LCD_MAX_Y - 32, 8, "[reset]", 0xffffu);
+		Lcd_Put_Text(LCD_MAX_X - 80, LCD_MAX_Y - 32, 8, "[return]", 0xffffu);
+		uiLatencyDraw("Tap above to refresh");
+		break;
+
+	case TOUCH_UP_EVENT:
+		Lcd_Translate_Touch_Pos((pxEvent->ucData.touchXY) >> 16 & 0x7fffu,
+				pxEvent->ucData.touchXY & 0x7fffu, &x, &y);
+		uiShortBeep();
+
+		if (y < LCD_MAX_Y - 48) {
+			uiLatencyDraw("Tap above to refresh");
+		} else if (x < LCD_MAX_X / 3) {
+			uiLatencyDump();
+			uiLatencyDraw("Sent to USART3");
+		} else if (x < LCD_MAX_X * 2 / 3) {
+			latencyReset();
+			uiLatencyDraw("Histograms cleared");
+		} else {
+			uiNextState(uiSetupAbout);
+		}
+		break;
+
+	default:
+		uiMenuHandleEventDefault(NULL, pxEvent);
+		break;
+	}
+}
+#endif /* LATENCY_TRACE */
+
+static const xMenuItem_t homeMenu[8] = {
+		{ MKS_PIC_FL "/bmp_zeroA.bin", NULL },
+		{ MKS_PIC_FL "/bmp_zeroX.bin", NULL },
+		{ MKS_PIC_FL "/bmp_zeroY.bin", NULL },
+		{ MKS_PIC_FL "/bmp_zeroZ.bin", NULL },
+		{ NULL, NULL },
+		{ NULL, NULL },
+		{ NULL, NULL },
+		{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
+};
+
+void uiHomeMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(homeMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Home", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Home");
 }
 
-void uiFanMenu (xUIEvent_t *pxEvent) {
+static const xMenuItem_t fanMenu[8] = {
+		{ MKS_PIC_FL "/bmp_Add.bin", NULL },
+		{ NULL, NULL },
+		{ NULL, NULL },
+		{ MKS_PIC_FL "/bmp_Dec.bin", NULL },
+		{ MKS_PIC_FL "/bmp_speed_high.bin", NULL },
+		{ MKS_PIC_FL "/bmp_speed_normal.bin", NULL },
+		{ MKS_PIC_FL "/bmp_stop.bin", NULL },
+		{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
+};
 
-	static const xMenuItem_t fanMenu[8] = {
-			{ MKS_PIC_FL "/bmp_Add.bin", NULL },
-			{ NULL, NULL },
-			{ NULL, NULL },
-			{ MKS_PIC_FL "/bmp_Dec.bin", NULL },
-			{ MKS_PIC_FL "/bmp_speed_high.bin", NULL },
-			{ MKS_PIC_FL "/bmp_speed_normal.bin", NULL },
-			{ MKS_PIC_FL "/bmp_stop.bin", NULL },
-			{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
-	};
+void uiFanMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(fanMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Fan", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Fan");
 }
 
 static xMenuItem_t moveMenu[8] = {
@@ -578,8 +896,133 @@ static xMenuItem_t moveMenu[8] = {
 		{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
 };
 
+/*
+ * jogging on the pad of the X and Y icons: a drag that went down on the pad
+ * moves one step every MOVE_JOG_PIXELS along the axis it clearly follows, a
+ * swipe or a fling adds at most MOVE_JOG_MAX steps. A diagonal stroke, or
+ * one that started elsewhere on the screen, moves nothing. The step is
+ * moveStep
+ * */
+
+#define MOVE_JOG_PIXELS		24		// px of drag per step
+#define MOVE_JOG_FLING		400		// px/s of fling per step
+#define MOVE_JOG_MAX		2		// steps of one fling at most
+#define MOVE_JOG_PAD_X2		160		// the X and Y icon columns
+#define MOVE_JOG_PAD_Y1		16
+#define MOVE_JOG_PAD_Y2		(18 + 104 + 104 - 1)
+#define MOVE_FEEDRATE		3000	// mm/min
+
+static const uint8_t moveTenths[] = {	// 0.1 mm
+	[MOVE_01] = 1, [MOVE_1] = 10, [MOVE_5] = 50, [MOVE_10] = 100
+};
+static int16_t jogX, jogY;			// drag not jogged yet, px
+static uint8_t jogArmed = 0;		// the pen went down on the pad
+
+static void uiMoveJog(char axis, int steps) {
+
+	char line[40];
+	int distance = steps * moveTenths[moveStep];
+
+	snprintf(line, sizeof(line), "G91\nG1 %c%s%d.%d F%u\nG90\n", axis,
+			(distance < 0) ? "-" : "", abs(distance) / 10, abs(distance) % 10,
+			MOVE_FEEDRATE);
+	if (comm1Transmit((const uint8_t *) line, strlen(line)) != HAL_OK) {
+		xUIEvent_t status = { SHOW_STATUS };
+
+		snprintf((char *) statString, sizeof(statString), "jog lost, printer port busy");
+		uiMenuHandleEventDefault(NULL, &status);
+	}
+}
+
+/* 'X' or 'Y' if the stroke is at least twice as long along it, else 0 */
+
+static char uiJogAxis(int x, int y) {
+
+	if (abs(x) >= 2 * abs(y))
+		return 'X';
+	if (abs(y) >= 2 * abs(x))
+		return 'Y';
+	return 0;
+}
+
+static void uiMoveFling(int vx, int vy, int steps) {
+
+	// screen up is +Y
+	char axis = uiJogAxis(vx, vy);
+	int v = (axis == 'X') ? vx : -vy;
+	int fast = abs(v) / MOVE_JOG_FLING;
+
+	jogArmed = 0;
+	if (!axis)
+		return;
+
+	if (fast > steps)
+		steps = fast;
+	if (steps > MOVE_JOG_MAX)
+		steps = MOVE_JOG_MAX;
+	if (steps)
+		uiMoveJog(axis, (v < 0) ? -steps : steps);
+}
+
 void uiMoveMenu (xUIEvent_t *pxEvent) {
 
+	uint16_t x, y;
+
+	switch (pxEvent->ucEventID) {
+	case INIT_EVENT:
+		jogX = jogY = 0;
+		jogArmed = 0;
+		break;
+
+	case TOUCH_DOWN_EVENT:
+		jogX = jogY = 0;
+		Lcd_Translate_Touch_Pos((pxEvent->ucData.touchXY) >> 16 & 0x7fffu,
+				pxEvent->ucData.touchXY & 0x7fffu, &x, &y);
+		jogArmed = x <= MOVE_JOG_PAD_X2 && y >= MOVE_JOG_PAD_Y1 && y <= MOVE_JOG_PAD_Y2;
+		break;
+
+	case TOUCH_MOVE_EVENT:
+		if (!jogArmed)
+			return;
+
+		jogX += pxEvent->ucData.vector.x;
+		jogY -= pxEvent->ucData.vector.y;
+
+		switch (uiJogAxis(jogX, jogY)) {
+		case 'X':
+			if (abs(jogX) >= MOVE_JOG_PIXELS) {
+				uiMoveJog('X', jogX / MOVE_JOG_PIXELS);
+				jogX %= MOVE_JOG_PIXELS;
+				jogY = 0;
+			}
+			break;
+		case 'Y':
+			if (abs(jogY) >= MOVE_JOG_PIXELS) {
+				uiMoveJog('Y', jogY / MOVE_JOG_PIXELS);
+				jogY %= MOVE_JOG_PIXELS;
+				jogX = 0;
+			}
+			break;
+		}
+		return;
+
+	case SWIPE_LEFT_EVENT:
+	case SWIPE_RIGHT_EVENT:
+	case SWIPE_UP_EVENT:
+	case SWIPE_DOWN_EVENT:
+		if (jogArmed)
+			uiMoveFling(pxEvent->ucData.vector.x, pxEvent->ucData.vector.y, 1);
+		return;
+
+	case FLING_EVENT:
+		if (jogArmed)
+			uiMoveFling(pxEvent->ucData.vector.x, pxEvent->ucData.vector.y, 0);
+		return;
+
+	default:
+		break;
+	}
+
 	switch(moveStep) {
 	case MOVE_10:
 		moveMenu[3].pIconFile = MKS_PIC_FL "/bmp_step_move0_1.bin";
@@ -597,7 +1040,7 @@ void uiMoveMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(moveMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">Move", 0xffffu);
+		uiMenuTitle(READY_PRINT ">Move");
 }
 
 static xMenuItem_t preheatMenu[8] = {
@@ -646,7 +1089,7 @@ void uiPreheatMenu(xUIEvent_t *pxEvent) {
 
     uiMenuHandleEventDefault(preheatMenu, pxEvent);
     if (INIT_EVENT == pxEvent->ucEventID)
-        Lcd_Put_Text(0, 0, 16, READY_PRINT ">Preheat", 0xffffu);
+        uiMenuTitle(READY_PRINT ">Preheat");
 }
 
 void uiPreheatSelectDev(xUIEvent_t *pxEvent) {
@@ -666,10 +1109,7 @@ void uiPreheatSelectDev(xUIEvent_t *pxEvent) {
             break;
         }
     }
-
-    processEvent = uiPreheatMenu;
-	xUIEvent_t event = { UPDATE5_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiPreheatMenu);
 }
 
 void uiPreheatSelectStep(xUIEvent_t *pxEvent) {
@@ -690,10 +1130,7 @@ void uiPreheatSelectStep(xUIEvent_t *pxEvent) {
             break;
         }
     }
-
-    processEvent = uiPreheatMenu;
-	xUIEvent_t event = { UPDATE6_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiPreheatMenu);
 }
 
 static xMenuItem_t extrudeMenu[8] = {
@@ -754,7 +1191,7 @@ void uiExtrudeMenu(xUIEvent_t *pxEvent) {
 
     uiMenuHandleEventDefault(extrudeMenu, pxEvent);
     if (INIT_EVENT == pxEvent->ucEventID)
-        Lcd_Put_Text(0, 0, 16, READY_PRINT ">Extrude", 0xffffu);
+        uiMenuTitle(READY_PRINT ">Extrude");
 }
 
 void uiExtrudeSelectDev(xUIEvent_t *pxEvent) {
@@ -771,10 +1208,7 @@ void uiExtrudeSelectDev(xUIEvent_t *pxEvent) {
             break;
         }
     }
-
-    processEvent = uiExtrudeMenu;
-	xUIEvent_t event = { UPDATE5_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiExtrudeMenu);
 }
 
 void uiExtrudeSelectStep(xUIEvent_t *pxEvent) {
@@ -795,10 +1229,7 @@ void uiExtrudeSelectStep(xUIEvent_t *pxEvent) {
             break;
         }
     }
-
-    processEvent = uiExtrudeMenu;
-	xUIEvent_t event = { UPDATE6_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiExtrudeMenu);
 }
 
 void uiExtrudeSelectSpeed(xUIEvent_t *pxEvent) {
@@ -819,10 +1250,7 @@ void uiExtrudeSelectSpeed(xUIEvent_t *pxEvent) {
             break;
         }
     }
-
-    processEvent = uiExtrudeMenu;
-	xUIEvent_t event = { UPDATE7_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiExtrudeMenu);
 }
 
 void uiMoveMenuStepChange (xUIEvent_t *pxEvent) {
@@ -843,46 +1271,210 @@ void uiMoveMenuStepChange (xUIEvent_t *pxEvent) {
 			break;
 		}
 	}
-
-	processEvent = uiMoveMenu;
-	xUIEvent_t event = { UPDATE4_EVENT };
-	xQueueSendToFront(xUIEventQueue, &event, 1000);
+	uiNextState(uiMoveMenu);
 }
 
-void uiMoreMenu (xUIEvent_t *pxEvent) {
+static const xMenuItem_t moreMenu[8] = {
+		{ MKS_PIC_FL /* "/bmp_morefunc1.bin" */ "/bmp_custom1.bin", NULL },
+		{ MKS_PIC_FL /* "/bmp_morefunc2.bin" */ "/bmp_custom2.bin", NULL },
+		{ MKS_PIC_FL /* "/bmp_morefunc3.bin" */ "/bmp_custom3.bin", NULL },
+		{ MKS_PIC_FL /* "/bmp_morefunc4.bin" */ "/bmp_custom4.bin", NULL },
+		{ MKS_PIC_FL /* "/bmp_morefunc5.bin" */ "/bmp_custom5.bin", NULL },
+		{ MKS_PIC_FL /* "/bmp_morefunc6.bin" */ "/bmp_custom6.bin", NULL },
+		{ NULL, NULL },
+		{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
+};
 
-	static const xMenuItem_t moreMenu[8] = {
-			{ MKS_PIC_FL /* "/bmp_morefunc1.bin" */ "/bmp_custom1.bin", NULL },
-			{ MKS_PIC_FL /* "/bmp_morefunc2.bin" */ "/bmp_custom2.bin", NULL },
-			{ MKS_PIC_FL /* "/bmp_morefunc3.bin" */ "/bmp_custom3.bin", NULL },
-			{ MKS_PIC_FL /* "/bmp_morefunc4.bin" */ "/bmp_custom4.bin", NULL },
-			{ MKS_PIC_FL /* "/bmp_morefunc5.bin" */ "/bmp_custom5.bin", NULL },
-			{ MKS_PIC_FL /* "/bmp_morefunc6.bin" */ "/bmp_custom6.bin", NULL },
-			{ NULL, NULL },
-			{ MKS_PIC_FL "/bmp_return.bin", uiMainMenu }
-	};
+void uiMoreMenu (xUIEvent_t *pxEvent) {
 
 	uiMenuHandleEventDefault(moreMenu, pxEvent);
 	if (INIT_EVENT == pxEvent->ucEventID)
-		Lcd_Put_Text(0, 0, 16, READY_PRINT ">More", 0xffffu);
+		uiMenuTitle(READY_PRINT ">More");
 }
 
+#if ICON_CACHE_SIZE
+/*
+ * menu screens, for the prefetch task: the icons of the screen most likely
+ * to be opened next from the current one are read into the icon cache while
+ * the UI is idle. The budget holds a couple of icons, so only that screen
+ * is read ahead; the likeliest is the item tapped most often so far
+ * */
+
+static const struct {
+	eventProcessor_t pEventProcessor;
+	const xMenuItem_t *pMenu;
+} menuScreens[] = {
+	{ uiMainMenu, mainMenu },
+	{ uiSetupMenu, setupMenu },
+	{ uiSetupFilesystemMenu, setupFilesystemMenu },
+	{ uiSetupConnectMenu, setupConnectMenu },
+	{ uiSetupWifi, setupWifiMenu },
+	{ uiSetupAbout, setupAboutMenu },
+	{ uiHomeMenu, homeMenu },
+	{ uiFanMenu, fanMenu },
+	{ uiMoveMenu, moveMenu },
+	{ uiPreheatMenu, preheatMenu },
+	{ uiExtrudeMenu, extrudeMenu },
+	{ uiMoreMenu, moreMenu }
+};
+
+#define MENU_SCREENS	(sizeof(menuScreens) / sizeof(menuScreens[0]))
+
+static uint8_t menuTaps[MENU_SCREENS][8];	// per screen and item, halved on overflow
+
+static int uiScreenIndex(eventProcessor_t processor) {
+
+	for (int i = 0; processor && i < (int) MENU_SCREENS; i++) {
+		if (menuScreens[i].pEventProcessor == processor)
+			return i;
+	}
+
+	return -1;
+}
+
+static const xMenuItem_t *uiScreenMenu(eventProcessor_t processor) {
+
+	int i = uiScreenIndex(processor);
+
+	return (i < 0) ? NULL : menuScreens[i].pMenu;
+}
+
+/* UI task, a menu item was tapped */
+
+static void uiMenuChosen(const xMenuItem_t *pMenu, eventProcessor_t processor) {
+
+	int screen = uiScreenIndex(processEvent);
+	uint8_t i, j;
+
+	if (screen < 0 || menuScreens[screen].pMenu != pMenu)
+		return;
+
+	for (i = 0; i < 8 && pMenu[i].pEventProcessor != processor; i++)
+		;
+	if (i == 8)
+		return;
+
+	if (menuTaps[screen][i] == UINT8_MAX) {
+		for (j = 0; j < 8; j++)
+			menuTaps[screen][j] >>= 1;
+	}
+	menuTaps[screen][i]++;
+}
+
+/* prefetch task context, stops when the cache is full or an event comes */
+
+void uiPrefetch(void) {
+
+	int screen = uiScreenIndex(processEvent);
+	const xMenuItem_t *pMenu, *pNext = NULL;
+	uint8_t best = 0;
+
+	if (screen < 0)
+		return;
+	pMenu = menuScreens[screen].pMenu;
+
+	for (uint8_t i = 0; i < 8; i++) {
+		const xMenuItem_t *pScreen = uiScreenMenu(pMenu[i].pEventProcessor);
+
+		if (pScreen && pScreen != pMenu && (!pNext || menuTaps[screen][i] > best)) {
+			pNext = pScreen;
+			best = menuTaps[screen][i];
+		}
+	}
+
+	for (uint8_t j = 0; pNext && j < 8; j++) {
+		if (pNext[j].pIconFile && !uiIconPrefetch(pNext[j].pIconFile, 78, 104))
+			return;
+	}
+}
+#endif /* ICON_CACHE_SIZE */
+
 
 static TCHAR fname_table[FLIST_SIZE][NAMELEN];
 static int row_selected = -1;
+static int list_top = 0;			// list entry shown in the first row
+static uint8_t list_more = 0;		// entries follow the last row
+static char list_status[MAXTEXTLEN + 1];	// bottom line of the browser
 
 static TCHAR cwd[_MAX_LFN + 1];
 
+/*
+ * a drag scrolls the list row by row under the pen, a swipe or a fling
+ * keeps it going and slowing down by FL_FLING_DECEL until it stops; the
+ * next event ends it at once, the wait between rows is on the event queue
+ * */
+
+#define FL_FLING_DECEL		1000	// px/s^2
+#define FL_FLING_STOP		(4 * FL_FONT_SIZE)	// px/s, slower - the list stops
+#define FL_SWIPE_SPEED		(40 * FL_FONT_SIZE)	// px/s a swipe starts with at least
+
+static int16_t list_drag = 0;		// drag not scrolled yet, px
+
+static uint8_t uiScrollFileList(int step);
+
+static void uiFlingFileList(int velocity) {
+
+	int step = (velocity < 0) ? -1 : 1;
+	uint32_t v = abs(velocity);
+	xUIEvent_t event;
+
+	while (v >= FL_FLING_STOP) {
+
+		uint32_t start = HAL_GetTick();
+		uint32_t row = FL_FONT_SIZE * 1000 / v;	// ms a row takes at this speed
+
+		if (!uiScrollFileList(step) || uxQueueMessagesWaiting(xUIEventQueue))
+			break;
+
+		v -= (FL_FLING_DECEL * row / 1000 < v) ? FL_FLING_DECEL * row / 1000 : v;
+
+		uint32_t spent = HAL_GetTick() - start;
+		if (spent < row && xQueuePeek(xUIEventQueue, &event,
+				(row - spent) / portTICK_PERIOD_MS) == pdTRUE)
+			break;
+	}
+}
+
 void uiFileBrowse(xUIEvent_t *pxEvent) {
 
+	int v;
+
 	switch (pxEvent->ucEventID) {
 	case TOUCH_DOWN_EVENT:
 		uiShortBeep();
+		list_drag = 0;
+		break;
 
+	case TOUCH_UP_EVENT:
+		// rows are picked on a tap, so that a drag may start on a folder
 		uiRedrawFileList((pxEvent->ucData.touchXY) >> 16 & 0x7fffu,
 				pxEvent->ucData.touchXY & 0x7fffu);
 		break;
 
+	case TOUCH_MOVE_EVENT:
+		// pen up - the entries below come in
+		list_drag -= pxEvent->ucData.vector.y;
+		for (; list_drag >= FL_FONT_SIZE; list_drag -= FL_FONT_SIZE)
+			uiScrollFileList(1);
+		for (; list_drag <= -FL_FONT_SIZE; list_drag += FL_FONT_SIZE)
+			uiScrollFileList(-1);
+		break;
+
+	case SWIPE_UP_EVENT:
+		v = -pxEvent->ucData.vector.y;
+		uiFlingFileList(v > FL_SWIPE_SPEED ? v : FL_SWIPE_SPEED);
+		break;
+
+	case SWIPE_DOWN_EVENT:
+		v = pxEvent->ucData.vector.y;
+		uiFlingFileList(v > FL_SWIPE_SPEED ? -v : -FL_SWIPE_SPEED);
+		break;
+
+	case FLING_EVENT:
+		if (abs(pxEvent->ucData.vector.y) >= abs(pxEvent->ucData.vector.x))
+			uiFlingFileList(-pxEvent->ucData.vector.y);
+		break;
+
 	case SDCARD_INSERT:
 	case SDCARD_REMOVE:
 	case USBDRIVE_INSERT:
@@ -893,6 +1485,8 @@ void uiFileBrowse(xUIEvent_t *pxEvent) {
 
 	case INIT_EVENT:
 		sprintf(cwd, "1:/");
+		list_top = 0;
+		uiWidgetInvalidate();	// the browser paints the whole screen itself
 		uiRedrawFileList(-1, -1);
 		break;
 
@@ -902,42 +1496,114 @@ void uiFileBrowse(xUIEvent_t *pxEvent) {
 	}
 }
 
-static FRESULT uiGetFileList(DIR *dir, uint8_t rootFolder) {
+/*
+ * read count list entries starting from entry first into fname_table rows
+ * starting from row; entry 0 of a subfolder is ">.."
+ */
+static FRESULT uiReadFileEntries(DIR *dir, uint8_t rootFolder, int first,
+		int row, int count, uint8_t *more) {
 
 	FILINFO *pFno;
 	FRESULT res = FR_OK;
-	size_t i=0;
+	int entry = rootFolder ? 0 : 1;
 
-	for (; i<FLIST_SIZE; i++)
-		fname_table[i][0] = '\0';
+	*more = 0;
 
-	if (!rootFolder)
-		sprintf(fname_table[0], ">..");
+	if (!rootFolder && first == 0 && count) {
+		sprintf(fname_table[row++], ">..");
+		first++;
+		count--;
+	}
 
 	if ((pFno = pvPortMalloc(sizeof(FILINFO))) != NULL) {
-		for (i = (rootFolder ? 0 : 1); i < FLIST_SIZE; i++) {
+
+		// skip entries scrolled out above
+		for (; entry < first; entry++) {
+			if (FR_OK != f_readdir(dir, pFno) || !pFno->fname[0]) {
+				count = 0;
+				break;
+			}
+		}
+
+		for (; count > 0; count--, row++) {
 
 			if (FR_OK == f_readdir(dir, pFno) && pFno->fname[0]) {
 
-				fname_table[i][0] = (pFno->fattrib & AM_DIR) ? '>' : ' ';
+				fname_table[row][0] = (pFno->fattrib & AM_DIR) ? '>' : ' ';
 				size_t k = 0;
 
-				for (; k < (NAMELEN - 1) && pFno->fname[k]; k++)
-					fname_table[i][k + 1] = pFno->fname[k];
+				for (; k < (NAMELEN - 2) && pFno->fname[k]; k++)
+					fname_table[row][k + 1] = pFno->fname[k];
 
-				fname_table[i][k + 1] = '\0';
+				fname_table[row][k + 1] = '\0';
 			} else {
+				fname_table[row][0] = '\0';
 				res = FR_NO_FILE;	// ???
 				break;
 			}
 		}
 
+		if (res == FR_OK && FR_OK == f_readdir(dir, pFno) && pFno->fname[0])
+			*more = 1;
+
 		vPortFree(pFno);
 	}
 
 	return res;
 }
 
+static FRESULT uiGetFileList(DIR *dir, uint8_t rootFolder) {
+
+	size_t i=0;
+
+	for (; i<FLIST_SIZE; i++)
+		fname_table[i][0] = '\0';
+
+	return uiReadFileEntries(dir, rootFolder, list_top, 0, FLIST_SIZE, &list_more);
+}
+
+/*
+ * scroll the list by one entry: one directory entry is read, the visible
+ * rows are redrawn opaquely, which costs less bus time than reading the
+ * list back to move it; returns 0 at either end of the list
+ */
+static uint8_t uiScrollFileList(int step) {
+
+	DIR dir;
+	int row = (step > 0) ? FLIST_SIZE - 1 : 0;
+	uint8_t more;
+
+	if ((step < 0 && !list_top) || (step > 0 && !list_more))
+		return 0;
+
+	if (FR_OK != f_opendir(&dir, cwd))
+		return 0;
+
+	int is_root = !strcmp(cwd + 1, ":/");
+
+	if (step > 0) {
+		memmove(fname_table[0], fname_table[1], sizeof(fname_table[0]) * (FLIST_SIZE - 1));
+		list_top++;
+		uiReadFileEntries(&dir, is_root, list_top + FLIST_SIZE - 1, row, 1, &list_more);
+	} else {
+		list_more |= fname_table[FLIST_SIZE - 1][0] != '\0';
+		memmove(fname_table[1], fname_table[0], sizeof(fname_table[0]) * (FLIST_SIZE - 1));
+		list_top--;
+		uiReadFileEntries(&dir, is_root, list_top, row, 1, &more);
+	}
+
+	f_closedir(&dir);
+
+	if (row_selected >= 0 && row_selected < FLIST_SIZE) {
+		row_selected -= step;
+		if (row_selected < 0 || row_selected >= FLIST_SIZE)
+			row_selected = 99;	// scrolled out, nothing highlighted
+	}
+
+	uiDrawFileList(0, FLIST_SIZE * FL_FONT_SIZE - 1);
+	return 1;
+}
+
 static void uiRedrawFileList(int raw_x, int raw_y) {
 
 	uint16_t x, y;
@@ -976,6 +1642,12 @@ static void uiRedrawFileList(int raw_x, int raw_y) {
 		Lcd_Translate_Touch_Pos(raw_x, raw_y, &x, &y);
 
 		row = y / FL_FONT_SIZE;
+		if (row >= FLIST_SIZE) {
+			// scroll bar below the list: left half up, right half down
+			uiScrollFileList(x < LCD_MAX_X / 2 ? -1 : 1);
+			return;
+		}
+
 		if (row == row_selected && row_selected >= 0) {
 			return;
 		}
@@ -985,6 +1657,7 @@ static void uiRedrawFileList(int raw_x, int raw_y) {
 			if (FR_OK == f_chdir(&fname_table[row][1])) {
 
 				f_getcwd(cwd, sizeof(cwd));
+				list_top = 0;
 				row = -1;
 			} else {
 				row = 99;
@@ -992,10 +1665,6 @@ static void uiRedrawFileList(int raw_x, int raw_y) {
 		}
 	}
 
-	// TODO: move below directory read
-	Lcd_Fill_Screen(0x001fu);
-	Lcd_Put_Text(0, LCD_MAX_Y - 9, 8, cwd, 0xffffu);
-
 	char buffer[12];
 //	sprintf(buffer, "%05u:%05u", x, y);
 //	Lcd_Put_Text(10, LCD_MAX_Y - 9, 8, buffer, 0xffffu);
@@ -1012,17 +1681,14 @@ static void uiRedrawFileList(int raw_x, int raw_y) {
 			res = uiGetFileList(&dir, is_root);
 			// if (res != FR_OK) {
 				sprintf(buffer, "=%04u", res);
-				Lcd_Put_Text(200, LCD_MAX_Y - 9, 8, buffer, 0xffffu);
 			// }
 			f_closedir(&dir);
 		} else {
 			sprintf(buffer, "*%04u", res);
-			Lcd_Put_Text(200, LCD_MAX_Y - 9, 8, buffer, 0xffffu);
 		}
 	}
 	else {
 		sprintf(buffer, "#%04d", row);
-		Lcd_Put_Text(200, LCD_MAX_Y - 9, 8, buffer, 0xffffu);
 	}
 
 	row_selected = row;
@@ -1031,13 +1697,47 @@ static void uiRedrawFileList(int raw_x, int raw_y) {
 
 		if (fname_table[file][0] == '\0')
 			break; /* Break on end of table */
-
-		Lcd_Put_Text(0, file * FL_FONT_SIZE, FL_FONT_SIZE, fname_table[file],
-				(file == row_selected) ? Lcd_Get_RGB565(31, 63, 0) : 0xffffu);
 	}
 
-	sprintf(buffer, "F%04u", file);
-	Lcd_Put_Text(240, LCD_MAX_Y - 9, 8, buffer, 0xffffu);
+	// cwd at 0, result at 200 and file count at 240 pixels
+	snprintf(list_status, sizeof(list_status), "%-25.25s%-5.5sF%04u", cwd, buffer, file);
+	uiDrawFileList(0, LCD_MAX_Y - 1);
+}
+
+/*
+ * compose screen rows y1..y2 of the browser strip by strip: background,
+ * selection bar and names reach the panel once, without clear-then-draw
+ * */
+
+static void uiDrawFileList(uint16_t y1, uint16_t y2) {
+
+	lcd_strip_t strip;
+
+	if (!Lcd_Strip_Begin(&strip, 0, y1, LCD_MAX_X, y2 - y1 + 1))
+		return;
+
+	do {
+		Lcd_Strip_Fill_Rect(&strip, 0, y1, LCD_MAX_X - 1, y2, 0x001fu);
+
+		for (int file = 0; file < FLIST_SIZE && fname_table[file][0]; file++) {
+
+			uint16_t y = file * FL_FONT_SIZE;
+
+			if (file == row_selected)
+				Lcd_Strip_Blend_Rect(&strip, 0, y, LCD_MAX_X - 1, y + FL_FONT_SIZE - 1,
+						0xffffu, 64);
+
+			Lcd_Strip_Text(&strip, 0, y, FL_FONT_SIZE, fname_table[file],
+					(file == row_selected) ? Lcd_Get_RGB565(31, 63, 0) : 0xffffu);
+		}
+
+		Lcd_Strip_Text(&strip, LCD_MAX_X / 4 - 16, FLIST_SIZE * FL_FONT_SIZE + 4, 8,
+				"[ up ]", 0xffffu);
+		Lcd_Strip_Text(&strip, LCD_MAX_X * 3 / 4 - 24, FLIST_SIZE * FL_FONT_SIZE + 4, 8,
+				"[down]", 0xffffu);
+		Lcd_Strip_Text(&strip, 0, LCD_MAX_Y - 9, 8, list_status, 0xffffu);
+
+	} while (Lcd_Strip_Next(&strip));
 }
 
 /*
@@ -1069,84 +1769,4 @@ static void uiMediaStateChange(uint16_t event) {
 	}
 }
 
-static uint32_t pBarScale = 0;
-static uint16_t pBarColor = 0xffffu;
-static uint32_t pBarProgress = 0;
-
-static void uiDrawProgressBar(uint32_t scale, uint16_t color) {
-
-	Lcd_Fill_Rect(10 - 2, 100 - 2, 310 + 2, 140 + 2, color);
-	Lcd_Fill_Rect(10 - 1, 100 - 1, 310 + 1, 140 + 1, 0);
-
-	pBarScale = scale;
-	pBarColor = color;
-	pBarProgress = 0;
-}
-
-static void uiUpdateProgressBar(uint32_t progress) {
-
-	uint16_t x0 = 300 * pBarProgress / pBarScale;
-	pBarProgress = progress;
-	uint16_t x1 = 300 * pBarProgress / pBarScale;
-
-	if (x0 < x1) {
-		Lcd_Fill_Rect(10 + x0, 100, 10 + x1, 140, pBarColor);
-	}
-}
-
-static void uiDrawBinIcon(const TCHAR *path, uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint8_t resetWindow) {
-
-	FIL *pIconFile = NULL;
-	BYTE *pBuffer = NULL;
-
-	if (!path)
-		return;
-
-	Lcd_Com_Data ((Lcd_Orientation() & 1) ? 0x0052 : 0x0050, x);
-	Lcd_Com_Data ((Lcd_Orientation() & 1) ? 0x0050 : 0x0052, y);
-	Lcd_Com_Data ((Lcd_Orientation() & 1) ? 0x0053 : 0x0051, x + width - 1);
-	Lcd_Com_Data ((Lcd_Orientation() & 1) ? 0x0051 : 0x0053, y + height - 1);
-
-	if ((pIconFile = pvPortMalloc(sizeof(FIL))) != NULL
-			&& (pBuffer = pvPortMalloc(_MIN_SS)) != NULL) {
-
-		if (f_open(pIconFile, path, FA_READ) == FR_OK) {
-
-			size_t bytes = (size_t) -1;
-
-			Lcd_Go_XY(x, y);
-			Lcd_Com (0x0022);
-
-			HAL_GPIO_WritePin(LCD_nWR_GPIO_Port, LCD_nWR_Pin, GPIO_PIN_SET);
-			HAL_GPIO_WritePin(LCD_nRD_GPIO_Port, LCD_nRD_Pin, GPIO_PIN_SET);
-			HAL_GPIO_WritePin(LCD_RS_GPIO_Port,  LCD_RS_Pin,  GPIO_PIN_SET);
-
-			do {
-				f_read(pIconFile, pBuffer, _MIN_SS, &bytes);
-				if (bytes) {
-
-					for (size_t i=0; i<bytes; i+=2) {
-
-						GPIOE->ODR = *(uint16_t *)&pBuffer[i];
-					    GPIOB->BSRR = (uint32_t)LCD_nWR_Pin << 16;
-						GPIOB->BSRR = LCD_nWR_Pin;
-					}
-				}
-			} while (bytes);
-
-			f_close(pIconFile);
-		}
-	}
-
-	if (pIconFile) vPortFree(pIconFile);
-	if (pBuffer) vPortFree(pBuffer);
-
-	if (resetWindow) {
-		Lcd_Com_Data(0x0050, 0x0000);		  // Window Horizontal RAM Address Start (R50h)
-		Lcd_Com_Data(0x0051, 239);			  // Window Horizontal RAM Address End (R51h)
-		Lcd_Com_Data(0x0052, 0x0000);		  // Window Vertical RAM Address Start (R52h)
-		Lcd_Com_Data(0x0053, 319);			  // Window Vertical RAM Address End (R53h)
-	}
-}
-
 /************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
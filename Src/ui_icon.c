@@ -0,0 +1,829 @@
+/**
+  ******************************************************************************
+  * File Name          : ui_icon.c
+  * Description        : This file contains icon loading from files and the icon pack
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include <ctype.h>
+
+#include "ui_icon.h"
+#include "fatfs.h"
+
+/*
+ * with the pixel pump, or with DMA reads from the flash asset region, the
+ * next sector is read while the previous one is being sent to the panel,
+ * two sector buffers take turns
+ * */
+
+#define ICON_FLASH_DMA	(WFLASH_ASSET_SECTORS && WFLASH_DMA)
+
+#if LCD_PUMP || ICON_FLASH_DMA
+# define ICON_BUFFERS	2
+#else
+# define ICON_BUFFERS	1
+#endif
+
+static FIL *pPackFile = NULL;
+static xIconPackEntry_t *pPackEntries = NULL;
+static uint16_t packCount = 0;
+static DWORD packClmt[ICON_PACK_CLMT];
+
+#if ICON_CACHE_SIZE
+typedef struct xIconCached {
+	struct xIconCached *pNext;
+	uint32_t hash;
+	uint32_t size;
+	uint16_t width;
+	uint16_t height;
+	// the icon file image follows
+} xIconCached_t;
+
+static xIconCached_t *pCacheHead = NULL;	// most recently drawn first
+static xIconCacheStats_t cacheStats;
+static uint32_t cacheHash = 0;				// icon uiDrawBinIcon() is reading
+static uint8_t cacheWanted = 0;
+
+// icons bigger than the whole budget, skipped without opening them again
+#define ICON_TOO_LARGE	16
+static uint32_t tooLargeHashes[ICON_TOO_LARGE];
+static uint8_t tooLargeNext = 0;
+#endif /* ICON_CACHE_SIZE */
+
+static SemaphoreHandle_t xIconMutex = NULL;
+static volatile uint8_t iconYield = 0;		// the UI task waits for the lock
+
+uint32_t uiIconHash(const char *name) {
+
+	uint32_t hash = 2166136261u;	// FNV-1a, FatFs names are case insensitive
+
+	while (name && *name) {
+		hash ^= (uint8_t) tolower((uint8_t) *name++);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+ * an icon is read front to back from its own file, from the pack file,
+ * straight from the raw flash asset region (pFile is NULL, the read is
+ * opened by the caller) or from the cache (pMemory), never more than size
+ * bytes; pCopy collects what was read for the cache
+ * */
+
+#define ICON_MEMORY_PIECE	0x8000u	// bytes handed out at once from RAM
+
+typedef struct {
+	FIL *pFile;
+	uint32_t size;			// bytes left, not requested yet
+	BYTE *pBuffer;			// ICON_BUFFERS * _MIN_SS, for uiIconNext()
+	uint8_t turn;			// buffer of the next piece
+	size_t ahead;			// bytes on their way into it, flash DMA
+	const BYTE *pMemory;
+	BYTE *pCopy;
+} xIconSource_t;
+
+static size_t uiIconRead(xIconSource_t *pSource, void *pData, size_t size) {
+
+	size_t bytes = 0;
+
+	if (size > pSource->size)
+		size = pSource->size;
+
+	if (pSource->pFile)
+		f_read(pSource->pFile, pData, size, &bytes);
+#if WFLASH_ASSET_SECTORS
+	else if (size && continueReadFLASH(pData, size) == HAL_OK)
+		bytes = size;
+#endif /* WFLASH_ASSET_SECTORS */
+
+	pSource->size -= bytes;
+	return bytes;
+}
+
+#if ICON_FLASH_DMA
+static size_t uiIconRequest(xIconSource_t *pSource, BYTE *pData) {
+
+	size_t bytes = (pSource->size < _MIN_SS) ? pSource->size : _MIN_SS;
+
+	if (bytes && startReadFLASH(pData, bytes) != HAL_OK)
+		bytes = 0;
+
+	pSource->size -= bytes;
+	return bytes;
+}
+#endif /* ICON_FLASH_DMA */
+
+/*
+ * the next piece of the icon, up to a sector, valid until the call after
+ * the next one; from the flash region the following piece is read by DMA
+ * into the other buffer while the caller sends this one to the panel
+ * */
+
+static size_t uiIconNext(xIconSource_t *pSource, const BYTE **ppData) {
+
+	BYTE *pData = pSource->pBuffer + pSource->turn * _MIN_SS;
+	size_t bytes;
+
+	if (pSource->pMemory) {
+		bytes = (pSource->size < ICON_MEMORY_PIECE) ? pSource->size : ICON_MEMORY_PIECE;
+
+		*ppData = pSource->pMemory;
+		pSource->pMemory += bytes;
+		pSource->size -= bytes;
+		return bytes;
+	}
+
+#if ICON_FLASH_DMA
+	if (!pSource->pFile) {
+		bytes = pSource->ahead ? pSource->ahead : uiIconRequest(pSource, pData);
+		if (waitReadFLASH() != HAL_OK)
+			bytes = pSource->size = 0;
+
+		pSource->turn ^= 1;
+#if LCD_PUMP
+		Lcd_Pump_Wait();	// the other buffer may still be on its way out
+#endif
+		pSource->ahead = uiIconRequest(pSource, pSource->pBuffer + pSource->turn * _MIN_SS);
+	} else
+#endif /* ICON_FLASH_DMA */
+	{
+		bytes = uiIconRead(pSource, pData, _MIN_SS);
+#if ICON_BUFFERS > 1
+		pSource->turn ^= 1;
+#endif
+	}
+
+	if (pSource->pCopy) {
+		memcpy(pSource->pCopy, pData, bytes);
+		pSource->pCopy += bytes;
+	}
+
+	*ppData = pData;
+	return bytes;
+}
+
+static void uiIconDone(xIconSource_t *pSource) {
+
+#if ICON_FLASH_DMA
+	if (pSource->ahead)
+		waitReadFLASH();
+	pSource->ahead = 0;
+#else
+	(void) pSource;
+#endif /* ICON_FLASH_DMA */
+}
+
+/*
+ * an indexed icon is recognized by its header, which has to match the
+ * requested size too; the palette is kept aside and the indices are
+ * expanded sector by sector
+ * */
+
+static uint8_t uiIconIndexed(const xIconHeader_t *pHeader, size_t bytes,
+		uint16_t width, uint16_t height) {
+
+	return bytes >= sizeof(xIconHeader_t)
+			&& memcmp(pHeader->magic, ICON_MAGIC, sizeof(pHeader->magic)) == 0
+			&& (pHeader->bpp == 8 || pHeader->bpp == 4)
+			&& (pHeader->flags & ~ICON_RLE) == 0
+			&& pHeader->width == width && pHeader->height == height
+			&& pHeader->colors && pHeader->colors <= (1u << pHeader->bpp);
+}
+
+/*
+ * run-length decoder state, kept between sectors: a token may be split
+ * anywhere, runs go to the panel as one fill (nWR strobes only)
+ * */
+
+typedef struct {
+	const uint16_t *pPalette;
+	uint32_t pixels;		// left in the icon
+	uint16_t count;			// left in the current run or literal
+	uint8_t run;			// 1 - run, waiting for its index
+	uint8_t bpp;
+} xIconRle_t;
+
+static void uiIconRleDecode(xIconRle_t *pRle, const BYTE *pData, size_t bytes) {
+
+	while (bytes && pRle->pixels) {
+
+		if (!pRle->count) {
+			uint8_t token = *pData++;
+			bytes--;
+
+			pRle->run = token >> 7;
+			pRle->count = pRle->run ? (token & 0x7f) + 2 : token + 1;
+			if (pRle->count > pRle->pixels)
+				pRle->count = pRle->pixels;
+
+		} else if (pRle->run) {
+			Lcd_Stream_Fill(pRle->pPalette[*pData++], pRle->count);
+			bytes--;
+			pRle->pixels -= pRle->count;
+			pRle->count = 0;
+
+		} else {
+			// a literal is whole bytes, the last 4 bpp one may hold one pixel
+			size_t need = (pRle->bpp == 4) ? (pRle->count + 1) >> 1 : pRle->count;
+			size_t take = (need < bytes) ? need : bytes;
+			uint16_t count = (pRle->bpp == 4) ? take << 1 : take;
+
+			if (count > pRle->count)
+				count = pRle->count;
+
+			Lcd_Stream_Indexed(pData, count, pRle->bpp, pRle->pPalette);
+			pData += take;
+			bytes -= take;
+			pRle->pixels -= count;
+			pRle->count -= count;
+		}
+	}
+}
+
+/* pData holds the first bytes of the icon, header included */
+
+static void uiStreamIndexedIcon(xIconSource_t *pSource, const BYTE *pData, size_t bytes,
+		uint8_t bpp, uint8_t flags, uint16_t colors, uint32_t pixels) {
+
+	size_t paletteSize = colors * sizeof(uint16_t);
+	uint16_t *pPalette;
+
+	// every index has an entry, unused ones stay black
+	if ((pPalette = pvPortMalloc(sizeof(uint16_t) << bpp)) == NULL)
+		return;
+	memset(pPalette, 0, sizeof(uint16_t) << bpp);
+
+	pData += sizeof(xIconHeader_t);
+	bytes -= sizeof(xIconHeader_t);
+
+	for (size_t have = 0; have < paletteSize; ) {
+		if (!bytes && !(bytes = uiIconNext(pSource, &pData))) {
+			pixels = 0;
+			break;
+		}
+
+		size_t take = (paletteSize - have < bytes) ? paletteSize - have : bytes;
+
+		memcpy((BYTE *) pPalette + have, pData, take);
+		have += take;
+		pData += take;
+		bytes -= take;
+	}
+
+	if (flags & ICON_RLE) {
+		xIconRle_t rle = { pPalette, pixels, 0, 0, bpp };
+
+		uiIconRleDecode(&rle, pData, bytes);
+		while (rle.pixels && (bytes = uiIconNext(pSource, &pData)) != 0)
+			uiIconRleDecode(&rle, pData, bytes);
+
+	} else {
+		while (pixels) {
+			uint32_t count = bytes * (8 / bpp);
+			if (count > pixels)
+				count = pixels;
+
+			Lcd_Stream_Indexed(pData, count, bpp, pPalette);
+			pixels -= count;
+
+			if (pixels && !(bytes = uiIconNext(pSource, &pData)))
+				break;
+		}
+	}
+
+	vPortFree(pPalette);
+}
+
+#if ICON_CACHE_SIZE
+static void uiIconCacheFree(xIconCached_t **ppLink) {
+
+	xIconCached_t *pCached = *ppLink;
+
+	*ppLink = pCached->pNext;
+	cacheStats.bytes -= pCached->size;
+	cacheStats.icons--;
+	vPortFree(pCached);
+}
+
+static uint8_t uiIconIsTooLarge(uint32_t hash) {
+
+	for (uint8_t i = 0; i < ICON_TOO_LARGE; i++) {
+		if (tooLargeHashes[i] == hash && hash)
+			return 1;
+	}
+
+	return 0;
+}
+
+/* counted once, the oldest is forgotten when all slots are taken */
+
+static void uiIconTooLarge(uint32_t hash) {
+
+	if (uiIconIsTooLarge(hash))
+		return;
+
+	tooLargeHashes[tooLargeNext] = hash;
+	tooLargeNext = (tooLargeNext + 1) % ICON_TOO_LARGE;
+	cacheStats.tooLarge++;
+}
+
+/* a cache entry, not linked until uiIconCacheInsert() */
+
+static xIconCached_t **uiIconCacheFind(uint32_t hash, uint16_t width, uint16_t height) {
+
+	xIconCached_t **ppLink = &pCacheHead;
+
+	while (*ppLink && ((*ppLink)->hash != hash || (*ppLink)->width != width
+			|| (*ppLink)->height != height))
+		ppLink = &(*ppLink)->pNext;
+
+	return ppLink;
+}
+
+static xIconCached_t *uiIconCacheAlloc(uint32_t hash, uint32_t size, uint16_t width,
+		uint16_t height) {
+
+	xIconCached_t *pCached;
+
+	if (size > ICON_CACHE_SIZE) {
+		uiIconTooLarge(hash);
+		return NULL;
+	}
+
+	while (pCacheHead && cacheStats.bytes + size > ICON_CACHE_SIZE) {
+		xIconCached_t **ppLast = &pCacheHead;
+
+		while ((*ppLast)->pNext)
+			ppLast = &(*ppLast)->pNext;
+		uiIconCacheFree(ppLast);
+	}
+
+	if ((pCached = pvPortMalloc(sizeof(xIconCached_t) + size)) != NULL) {
+		pCached->hash = hash;
+		pCached->size = size;
+		pCached->width = width;
+		pCached->height = height;
+	}
+
+	return pCached;
+}
+
+static void uiIconCacheInsert(xIconCached_t *pCached, const BYTE *pEnd) {
+
+	if (pEnd != (const BYTE *)(pCached + 1) + pCached->size) {
+		vPortFree(pCached);		// read error, or the icon wasn't read to the end
+		return;
+	}
+
+	pCached->pNext = pCacheHead;
+	pCacheHead = pCached;
+	cacheStats.bytes += pCached->size;
+	cacheStats.icons++;
+}
+
+void uiIconCacheStats(xIconCacheStats_t *pStats) {
+
+	*pStats = cacheStats;
+}
+
+void uiIconCacheFlush(void) {
+
+	while (pCacheHead)
+		uiIconCacheFree(&pCacheHead);
+	memset(tooLargeHashes, 0, sizeof(tooLargeHashes));	// may be converted now
+}
+#endif /* ICON_CACHE_SIZE */
+
+static void uiStreamIcon(xIconSource_t *pSource, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height) {
+
+	const BYTE *pData;
+	size_t bytes;
+
+#if ICON_CACHE_SIZE
+	xIconCached_t *pCached = NULL;
+
+	if (cacheWanted && !pSource->pMemory
+			&& (pCached = uiIconCacheAlloc(cacheHash, pSource->size, width, height)) != NULL)
+		pSource->pCopy = (BYTE *)(pCached + 1);
+#endif /* ICON_CACHE_SIZE */
+
+	bytes = uiIconNext(pSource, &pData);
+
+	Lcd_Stream_Begin(x, y, width, height);
+
+	if (uiIconIndexed((const xIconHeader_t *)pData, bytes, width, height)) {
+		const xIconHeader_t *pHeader = (const xIconHeader_t *)pData;
+
+		uiStreamIndexedIcon(pSource, pData, bytes, pHeader->bpp, pHeader->flags,
+				pHeader->colors, (uint32_t)width * height);
+	} else {
+		while (bytes) {
+#if LCD_PUMP
+			Lcd_Pump_Pixels((const uint16_t *)pData, bytes >> 1, NULL, NULL);
+#else
+			Lcd_Stream_Pixels((const uint16_t *)pData, bytes >> 1);
+#endif
+			bytes = uiIconNext(pSource, &pData);
+		}
+	}
+
+	uiIconDone(pSource);
+#if LCD_PUMP
+	Lcd_Pump_Wait();	// the buffer is freed by the caller
+#endif
+	Lcd_Stream_End();
+
+#if ICON_CACHE_SIZE
+	if (pCached)
+		uiIconCacheInsert(pCached, pSource->pCopy);
+#endif /* ICON_CACHE_SIZE */
+}
+
+static void uiDrawFileIcon(const char *path, uint16_t x, uint16_t y, uint16_t width,
+		uint16_t height) {
+
+	FIL *pIconFile = NULL;
+	BYTE *pBuffer = NULL;
+
+	if ((pIconFile = pvPortMalloc(sizeof(FIL))) != NULL
+			&& (pBuffer = pvPortMalloc(ICON_BUFFERS * _MIN_SS)) != NULL) {
+
+		if (f_open(pIconFile, path, FA_READ) == FR_OK) {
+			xIconSource_t source = { pIconFile, f_size(pIconFile), pBuffer, 0, 0, NULL, NULL };
+
+			uiStreamIcon(&source, x, y, width, height);
+			f_close(pIconFile);
+		}
+	}
+
+	if (pIconFile) vPortFree(pIconFile);
+	if (pBuffer) vPortFree(pBuffer);
+}
+
+/* header and entry table, the same from either pack location */
+
+static uint8_t uiIconPackLoad(xIconSource_t *pSource) {
+
+	xIconPackHeader_t header;
+	size_t tableSize;
+
+	if (uiIconRead(pSource, &header, sizeof(header)) != sizeof(header)
+			|| memcmp(header.magic, ICON_PACK_MAGIC, sizeof(header.magic)) != 0
+			|| !header.count)
+		return 0;
+
+	tableSize = header.count * sizeof(xIconPackEntry_t);
+
+	if ((pPackEntries = pvPortMalloc(tableSize)) == NULL
+			|| uiIconRead(pSource, pPackEntries, tableSize) != tableSize)
+		return 0;
+
+	packCount = header.count;
+	return 1;
+}
+
+/*
+ * a pack in the raw flash asset region is read without FatFs, one read
+ * command per icon. A pack file stays open with a cluster link map, so
+ * seeking to an icon costs no FAT chain walk; a fragmented pack that
+ * doesn't fit the map is still used, with normal seeks
+ * */
+
+void uiIconPackOpen(void) {
+
+	uiIconPackClose();
+#if ICON_CACHE_SIZE
+	uiIconCacheFlush();		// the icons may have been installed again
+#endif /* ICON_CACHE_SIZE */
+
+#if WFLASH_ASSET_SECTORS
+	xIconSource_t flash = { NULL, openFLASHAssets(), NULL, 0, 0, NULL, NULL };
+
+	if (flash.size) {
+		uint8_t loaded = 0;
+
+		if (beginReadFLASH(WFLASH_ASSET_DATA) == HAL_OK)
+			loaded = uiIconPackLoad(&flash);
+		endReadFLASH();
+
+		if (loaded)
+			return;
+		uiIconPackClose();
+	}
+#endif /* WFLASH_ASSET_SECTORS */
+
+	if ((pPackFile = pvPortMalloc(sizeof(FIL))) == NULL)
+		return;
+
+	if (f_open(pPackFile, ICON_PACK_PATH, FA_READ) == FR_OK) {
+		xIconSource_t file = { pPackFile, f_size(pPackFile), NULL, 0, 0, NULL, NULL };
+
+		if (uiIconPackLoad(&file)) {
+			packClmt[0] = ICON_PACK_CLMT;
+			pPackFile->cltbl = packClmt;
+			if (f_lseek(pPackFile, CREATE_LINKMAP) != FR_OK)
+				pPackFile->cltbl = NULL;
+			return;
+		}
+
+		f_close(pPackFile);
+	}
+
+	uiIconPackClose();
+}
+
+void uiIconPackClose(void) {
+
+	if (pPackFile && packCount)
+		f_close(pPackFile);
+
+	if (pPackFile) vPortFree(pPackFile);
+	if (pPackEntries) vPortFree(pPackEntries);
+
+	pPackFile = NULL;
+	pPackEntries = NULL;
+	packCount = 0;
+}
+
+int uiIconFind(uint32_t hash) {
+
+	int lo = 0, hi = (int) packCount - 1;
+
+	while (lo <= hi) {
+		int mid = (lo + hi) / 2;
+
+		if (pPackEntries[mid].hash == hash)
+			return mid;
+		if (pPackEntries[mid].hash < hash)
+			lo = mid + 1;
+		else
+			hi = mid - 1;
+	}
+
+	return -1;
+}
+
+void uiDrawPackIcon(int index, uint16_t x, uint16_t y) {
+
+	const xIconPackEntry_t *pEntry;
+	BYTE *pBuffer;
+
+	if (index < 0 || index >= packCount)
+		return;
+
+	pEntry = &pPackEntries[index];
+
+	if ((pBuffer = pvPortMalloc(ICON_BUFFERS * _MIN_SS)) != NULL) {
+		xIconSource_t source = { pPackFile, pEntry->size, pBuffer, 0, 0, NULL, NULL };
+
+#if WFLASH_ASSET_SECTORS
+		if (!pPackFile) {
+			if (beginReadFLASH(WFLASH_ASSET_DATA + pEntry->offset) == HAL_OK)
+				uiStreamIcon(&source, x, y, pEntry->width, pEntry->height);
+			endReadFLASH();
+		} else
+#endif /* WFLASH_ASSET_SECTORS */
+		if (f_lseek(pPackFile, pEntry->offset) == FR_OK)
+			uiStreamIcon(&source, x, y, pEntry->width, pEntry->height);
+
+		vPortFree(pBuffer);
+	}
+}
+
+static int uiPackIndex(const char *path, uint16_t width, uint16_t height) {
+
+	const char *name = strrchr(path, '/');
+	int index;
+
+	if (!packCount)
+		return -1;
+
+	index = uiIconFind(uiIconHash(name ? name + 1 : path));
+
+	if (index >= 0 && (pPackEntries[index].width != width
+			|| pPackEntries[index].height != height))
+		return -1;
+
+	return index;
+}
+
+#if ICON_CACHE_SIZE
+/* a hit moves to the front of the list */
+
+static uint8_t uiDrawCachedIcon(uint32_t hash, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height) {
+
+	xIconCached_t **ppLink = uiIconCacheFind(hash, width, height);
+	xIconCached_t *pCached = *ppLink;
+
+	if (!pCached) {
+		cacheStats.misses++;
+		return 0;
+	}
+
+	*ppLink = pCached->pNext;
+	pCached->pNext = pCacheHead;
+	pCacheHead = pCached;
+
+	xIconSource_t source = { NULL, pCached->size, NULL, 0, 0,
+			(const BYTE *)(pCached + 1), NULL };
+
+	uiStreamIcon(&source, x, y, width, height);
+
+	cacheStats.hits++;
+	cacheStats.bytesSaved += pCached->size;
+	return 1;
+}
+
+/*
+ * reads the icon file image into the cache, a sector at a time, without
+ * evicting anything; gives up as soon as the UI task wants the lock
+ * */
+
+static uint8_t uiIconFetch(FIL *pFile, uint32_t address, xIconCached_t *pCached) {
+
+	BYTE *pData = (BYTE *)(pCached + 1);
+	uint32_t done = 0;
+
+	while (done < pCached->size && !iconYield) {
+
+		size_t bytes = (pCached->size - done < _MIN_SS) ? pCached->size - done : _MIN_SS;
+		size_t got = 0;
+
+#if WFLASH_ASSET_SECTORS
+		if (!pFile) {
+			// one read command per sector, task switches stay suspended only that long
+			HAL_StatusTypeDef res = beginReadFLASH(address + done);
+
+			if (res == HAL_OK && (res = continueReadFLASH(pData + done, bytes)) == HAL_OK)
+				got = bytes;
+			endReadFLASH();
+		} else
+#endif /* WFLASH_ASSET_SECTORS */
+		f_read(pFile, pData + done, bytes, &got);
+
+		if (got != bytes)
+			break;
+		done += bytes;
+	}
+
+	uiIconCacheInsert(pCached, pData + done);
+	return done == pCached->size;
+}
+
+uint8_t uiIconPrefetch(const char *path, uint16_t width, uint16_t height) {
+
+	uint32_t hash = uiIconHash(path);
+	xIconCached_t *pCached = NULL;
+	FIL *pFile = NULL;
+	uint8_t more = 1;
+	int index;
+
+	if (!path || iconYield || xSemaphoreTake(xIconMutex, 0) != pdTRUE)
+		return 0;
+
+	if (!uiIconIsTooLarge(hash) && *uiIconCacheFind(hash, width, height) == NULL) {
+
+		if ((index = uiPackIndex(path, width, height)) >= 0) {
+			const xIconPackEntry_t *pEntry = &pPackEntries[index];
+
+			if (pEntry->size > ICON_CACHE_SIZE)
+				uiIconTooLarge(hash);		// a big one is skipped
+			else if (pEntry->size > ICON_CACHE_SIZE - cacheStats.bytes)
+				more = 0;
+			else if ((pPackFile == NULL || f_lseek(pPackFile, pEntry->offset) == FR_OK)
+					&& (pCached = uiIconCacheAlloc(hash, pEntry->size, width, height)) != NULL)
+#if WFLASH_ASSET_SECTORS
+				more = uiIconFetch(pPackFile, WFLASH_ASSET_DATA + pEntry->offset, pCached);
+#else
+				more = uiIconFetch(pPackFile, 0, pCached);
+#endif /* WFLASH_ASSET_SECTORS */
+
+		} else if ((pFile = pvPortMalloc(sizeof(FIL))) != NULL) {
+
+			if (f_open(pFile, path, FA_READ) == FR_OK) {
+				uint32_t size = f_size(pFile);
+
+				if (size > ICON_CACHE_SIZE)
+					uiIconTooLarge(hash);
+				else if (size > ICON_CACHE_SIZE - cacheStats.bytes)
+					more = 0;
+				else if ((pCached = uiIconCacheAlloc(hash, size, width, height)) != NULL)
+					more = uiIconFetch(pFile, 0, pCached);
+				f_close(pFile);
+			}
+			vPortFree(pFile);
+		}
+
+		if (pCached && more)
+			cacheStats.prefetched++;
+	}
+
+	xSemaphoreGive(xIconMutex);
+	return more && !iconYield;
+}
+#endif /* ICON_CACHE_SIZE */
+
+/*
+ * FatFs isn't reentrant and the pack file has one position: the UI task
+ * holds the lock while it handles an event, the prefetch task while it
+ * reads one icon
+ * */
+
+void uiIconLockInit(void) {
+
+	xIconMutex = xSemaphoreCreateMutex();
+}
+
+void uiIconLock(void) {
+
+	iconYield = 1;
+	xSemaphoreTake(xIconMutex, portMAX_DELAY);
+	iconYield = 0;
+}
+
+void uiIconUnlock(void) {
+
+	xSemaphoreGive(xIconMutex);
+}
+
+void uiDrawBinIcon(const char *path, uint16_t x, uint16_t y, uint16_t width, uint16_t height) {
+
+	int index;
+
+	if (!path)
+		return;
+
+#if ICON_CACHE_SIZE
+	cacheHash = uiIconHash(path);
+	if (uiDrawCachedIcon(cacheHash, x, y, width, height))
+		return;
+	cacheWanted = 1;
+#endif /* ICON_CACHE_SIZE */
+
+	if ((index = uiPackIndex(path, width, height)) >= 0)
+		uiDrawPackIcon(index, x, y);
+	else
+		uiDrawFileIcon(path, x, y, width, height);
+
+#if ICON_CACHE_SIZE
+	cacheWanted = 0;
+#endif /* ICON_CACHE_SIZE */
+}
+
+#if LCD_BENCHMARK
+
+/* icons drawn at the menu positions, from their files and from the pack */
+
+void uiIconBenchmark(const char *const *paths, uint8_t count,
+		xIconBenchmark_t *result) {
+
+	uint32_t start;
+
+	start = HAL_GetTick();
+	for (uint8_t i = 0; i < count; i++) {
+		uiDrawFileIcon(paths[i], 1 + (i & 3) * 80, (i < 4) ? 16 : 18 + 104, 78, 104);
+	}
+	result->fileTicks = HAL_GetTick() - start;
+
+	start = HAL_GetTick();
+	for (uint8_t i = 0; i < count; i++) {
+		uiDrawPackIcon(uiPackIndex(paths[i], 78, 104), 1 + (i & 3) * 80,
+				(i < 4) ? 16 : 18 + 104);
+	}
+	result->packTicks = packCount ? HAL_GetTick() - start : 0;
+}
+
+#endif /* LCD_BENCHMARK */
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
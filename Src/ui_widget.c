@@ -0,0 +1,357 @@
+/**
+  ******************************************************************************
+  * File Name          : ui_widget.c
+  * Description        : This file contains retained mode widgets with dirty rectangle redraw
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+
+#include <string.h>
+#include <stdio.h>
+
+#include "ui.h"
+#include "ui_widget.h"
+#include "ui_icon.h"
+
+typedef struct {
+	int16_t x1, y1, x2, y2;
+} xRect_t;
+
+static xWidget_t widgets[WIDGET_MAX];
+static uint8_t widgetCount = 0;
+
+static xWidget_t oldWidgets[WIDGET_MAX];	// previous screen while building
+static uint8_t oldMatched[WIDGET_MAX];
+static uint8_t oldCount = 0;
+
+static xRect_t dirtyRects[WIDGET_DIRTYMAX];	// background to clear
+static uint8_t dirtyCount = 0;
+
+static uint16_t screenColor = 0;
+static uint8_t screenValid = 0;		// 0 - pixels not known, clear everything
+
+uint32_t uiHash(const char *text) {
+
+	uint32_t hash = 2166136261u;	// FNV-1a
+
+	while (text && *text) {
+		hash ^= (uint8_t) *text++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+ * background rectangles are merged while the bounding box wastes less than
+ * 1/8 of the area, a full list collapses into its first entry
+ * */
+
+static int32_t uiRectArea(const xRect_t *r) {
+	return (int32_t)(r->x2 - r->x1 + 1) * (r->y2 - r->y1 + 1);
+}
+
+static void uiWidgetDirtyRect(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
+
+	xRect_t r = { x1, y1, x2, y2 };
+
+	for (uint8_t i = 0; i < dirtyCount; ) {
+
+		xRect_t u = {
+			MIN(r.x1, dirtyRects[i].x1), MIN(r.y1, dirtyRects[i].y1),
+			MAX(r.x2, dirtyRects[i].x2), MAX(r.y2, dirtyRects[i].y2)
+		};
+
+		if (uiRectArea(&u) * 8 <= (uiRectArea(&r) + uiRectArea(&dirtyRects[i])) * 9) {
+			r = u;
+			dirtyRects[i] = dirtyRects[--dirtyCount];
+			i = 0;	// the bigger rectangle may now merge with earlier ones
+		} else {
+			i++;
+		}
+	}
+
+	if (dirtyCount == WIDGET_DIRTYMAX) {
+		dirtyRects[0].x1 = MIN(r.x1, dirtyRects[0].x1);
+		dirtyRects[0].y1 = MIN(r.y1, dirtyRects[0].y1);
+		dirtyRects[0].x2 = MAX(r.x2, dirtyRects[0].x2);
+		dirtyRects[0].y2 = MAX(r.y2, dirtyRects[0].y2);
+	} else {
+		dirtyRects[dirtyCount++] = r;
+	}
+}
+
+void uiWidgetBegin(uint16_t bgcolor) {
+
+	memcpy(oldWidgets, widgets, sizeof(widgets));
+	memset(oldMatched, 0, sizeof(oldMatched));
+	oldCount = widgetCount;
+
+	widgetCount = 0;
+	screenValid &= (bgcolor == screenColor);
+	screenColor = bgcolor;
+}
+
+static xWidget_t *uiWidgetAdd(uint8_t type, uint16_t x, uint16_t y,
+		uint16_t width, uint16_t height, uint16_t color) {
+
+	xWidget_t *widget;
+
+	if (widgetCount >= WIDGET_MAX)
+		return NULL;
+
+	widget = &widgets[widgetCount++];
+	memset(widget, 0, sizeof(*widget));
+
+	widget->type = type;
+	widget->x = x;
+	widget->y = y;
+	widget->width = width;
+	widget->height = height;
+	widget->color = color;
+	widget->bgcolor = screenColor;
+	widget->dirty = 1;
+
+	// same kind of widget at the same place keeps its pixels
+	for (uint8_t i = 0; screenValid && i < oldCount; i++) {
+
+		xWidget_t *old = &oldWidgets[i];
+
+		if (!oldMatched[i] && old->type == type && old->x == x && old->y == y
+				&& old->width == width && old->height == height) {
+
+			oldMatched[i] = 1;
+			widget->dirty = old->dirty;
+			widget->shown = old->shown;
+			break;
+		}
+	}
+
+	return widget;
+}
+
+xWidget_t *uiWidgetIcon(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		const char *path) {
+
+	xWidget_t *widget = uiWidgetAdd(WIDGET_ICON, x, y, width, height, 0);
+	if (widget) widget->icon = path;
+	return widget;
+}
+
+xWidget_t *uiWidgetLabel(uint16_t x, uint16_t y, uint16_t width, uint8_t height,
+		const char *text, uint16_t color) {
+
+	xWidget_t *widget = uiWidgetAdd(WIDGET_LABEL, x, y, width, height, color);
+	uiWidgetSetText(widget, text);
+	return widget;
+}
+
+xWidget_t *uiWidgetNumber(uint16_t x, uint16_t y, uint16_t width, const font_t *font,
+		int32_t value, uint16_t color) {
+
+	xWidget_t *widget = uiWidgetAdd(WIDGET_NUMBER, x, y, width,
+			font ? font->height : FONT_8x16, color);
+
+	if (widget) {
+		widget->font = font;
+		widget->value = value;
+	}
+	return widget;
+}
+
+xWidget_t *uiWidgetProgress(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
+		uint32_t scale, uint16_t color) {
+
+	xWidget_t *widget = uiWidgetAdd(WIDGET_PROGRESS, x, y, width, height, color);
+	if (widget) widget->scale = scale ? scale : 1;
+	return widget;
+}
+
+void uiWidgetEnd(void) {
+
+	if (!screenValid) {
+		uiWidgetDirtyRect(0, 0, LCD_MAX_X - 1, LCD_MAX_Y - 1);
+		screenValid = 1;
+	} else {
+		for (uint8_t i = 0; i < oldCount; i++) {
+			if (!oldMatched[i]) {
+				xWidget_t *old = &oldWidgets[i];
+				uiWidgetDirtyRect(old->x, old->y, old->x + old->width - 1,
+						old->y + old->height - 1);
+			}
+		}
+	}
+
+	oldCount = 0;
+}
+
+void uiWidgetSetIcon(xWidget_t *widget, const char *path) {
+	if (widget) widget->icon = path;
+}
+
+void uiWidgetSetText(xWidget_t *widget, const char *text) {
+	if (widget) snprintf(widget->text, sizeof(widget->text), "%s", text ? text : "");
+}
+
+void uiWidgetSetValue(xWidget_t *widget, int32_t value) {
+	if (widget) widget->value = value;
+}
+
+/*
+ * somebody else painted the screen: the next uiWidgetEnd() clears it all
+ * */
+
+void uiWidgetInvalidate(void) {
+	screenValid = 0;
+}
+
+static uint32_t uiProgressLength(const xWidget_t *widget) {
+
+	uint32_t value = widget->value < 0 ? 0 : widget->value;
+	if (value > widget->scale) value = widget->scale;
+
+	return (uint32_t)(widget->width - 2) * value / widget->scale;
+}
+
+static uint32_t uiWidgetFingerprint(const xWidget_t *widget) {
+
+	switch (widget->type) {
+	case WIDGET_ICON:
+		return uiHash(widget->icon);
+	case WIDGET_LABEL:
+		return uiHash(widget->text) * 31 + widget->color;
+	case WIDGET_NUMBER:
+		return (uint32_t)widget->value * 31 + widget->color;
+	case WIDGET_PROGRESS:
+	default:
+		return uiProgressLength(widget);
+	}
+}
+
+static void uiWidgetDraw(xWidget_t *widget, uint32_t fingerprint) {
+
+	uint16_t x2 = widget->x + widget->width - 1;
+	uint16_t y2 = widget->y + widget->height - 1;
+	char buffer[WIDGET_TEXTLEN + 1];
+
+	switch (widget->type) {
+	case WIDGET_ICON:
+		if (widget->icon) {
+			uiDrawBinIcon(widget->icon, widget->x, widget->y, widget->width,
+					widget->height);
+		} else {
+			Lcd_Fill_Rect(widget->x, widget->y, x2, y2, widget->bgcolor);
+		}
+		break;
+
+	case WIDGET_LABEL:
+		// padded to the widget width, opaque cells clear the old text
+		snprintf(buffer, sizeof(buffer), "%-*.*s", widget->width / 8,
+				widget->width / 8, widget->text);
+		Lcd_Put_Text_Opaque(widget->x, widget->y, widget->height, buffer,
+				widget->color, widget->bgcolor);
+		if (widget->width & 7) {
+			Lcd_Fill_Rect(x2 - (widget->width & 7) + 1, widget->y, x2, y2,
+					widget->bgcolor);
+		}
+		break;
+
+	case WIDGET_NUMBER:
+		snprintf(buffer, sizeof(buffer), "%ld", (long) widget->value);
+		if (widget->font) {
+			uint16_t x = Lcd_Put_Font_Text(widget->x, widget->y, widget->font,
+					buffer, widget->color, widget->bgcolor);
+			if (x <= x2) Lcd_Fill_Rect(x, widget->y, x2, y2, widget->bgcolor);
+		} else {
+			uint16_t cells = widget->width / 8;
+			snprintf(buffer, sizeof(buffer), "%*ld", cells, (long) widget->value);
+			Lcd_Put_Text_Opaque(widget->x, widget->y, FONT_8x16, buffer,
+					widget->color, widget->bgcolor);
+		}
+		break;
+
+	case WIDGET_PROGRESS:
+		{
+			uint16_t bx = widget->x + 1;
+
+			if (widget->dirty) {
+				Lcd_Rect(widget->x, widget->y, x2, y2, widget->color);
+				if (fingerprint)
+					Lcd_Fill_Rect(bx, widget->y + 1, bx + fingerprint - 1, y2 - 1,
+							widget->color);
+				if (bx + fingerprint < x2)
+					Lcd_Fill_Rect(bx + fingerprint, widget->y + 1, x2 - 1, y2 - 1,
+							widget->bgcolor);
+			} else if (fingerprint > widget->shown) {
+				// only the grown or shrunk part of the bar
+				Lcd_Fill_Rect(bx + widget->shown, widget->y + 1, bx + fingerprint - 1,
+						y2 - 1, widget->color);
+			} else {
+				Lcd_Fill_Rect(bx + fingerprint, widget->y + 1, bx + widget->shown - 1,
+						y2 - 1, widget->bgcolor);
+			}
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void uiWidgetRedraw(void) {
+
+	for (uint8_t d = 0; d < dirtyCount; d++) {
+
+		xRect_t *r = &dirtyRects[d];
+		Lcd_Fill_Rect(r->x1, r->y1, r->x2, r->y2, screenColor);
+
+		for (uint8_t i = 0; i < widgetCount; i++) {
+			xWidget_t *widget = &widgets[i];
+
+			if (widget->x <= r->x2 && widget->x + widget->width - 1 >= r->x1
+					&& widget->y <= r->y2 && widget->y + widget->height - 1 >= r->y1)
+				widget->dirty = 1;
+		}
+	}
+
+	dirtyCount = 0;
+
+	for (uint8_t i = 0; i < widgetCount; i++) {
+
+		xWidget_t *widget = &widgets[i];
+		uint32_t fingerprint = uiWidgetFingerprint(widget);
+
+		if (widget->dirty || fingerprint != widget->shown) {
+			uiWidgetDraw(widget, fingerprint);
+			widget->shown = fingerprint;
+			widget->dirty = 0;
+		}
+	}
+}
+
+/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/
@@ -0,0 +1,208 @@
+#!/usr/bin/env python3
+#
+# fontgen.py - build-time font compiler for the MKS-TFT firmware
+#
+# Reads the 8xN CP866 PSF tables from Src/cp866-8x*.c and generates
+# Src/fonts.c / Inc/fonts.h with font_t tables for Lcd_Put_Font_Text():
+#
+#   * proportional glyphs: empty columns trimmed, per-glyph advance
+#   * scaled glyphs with 2 or 4 bit alpha (bilinear upscale of the bitmap,
+#     thresholded on a supersampled grid and box filtered back down)
+#   * every glyph is run-length coded: one byte per run, the value (0 or
+#     alpha) in the top bpp bits, run length - 1 in the rest; runs continue
+#     across rows, so a glyph is decoded straight into one GRAM window
+#
+# usage: tools/fontgen.py [repo root]
+#
+# COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+
+import os
+import re
+import sys
+
+SUPERSAMPLE = 4
+
+# name, source height, scale, bpp, characters
+FONTS = [
+    ('font_prop16',    16, 1, 1, [chr(c) for c in range(0x20, 0x100)]),
+    ('font_digits32',  16, 2, 2, list(' +-./0123456789:C%')),
+    ('font_digits48',  16, 3, 4, list(' +-./0123456789:C%')),
+]
+
+
+def load_psf(root, height):
+    path = os.path.join(root, 'Src', 'cp866-8x%d.c' % height)
+    text = open(path, encoding='latin-1').read()
+    rows = re.findall(r'\{([^{}]*)\}', text[text.index('] = {') + 5:])
+    table = []
+    for row in rows:
+        table.append([int(v, 16) for v in row.replace(' ', '').split(',') if v])
+    assert len(table) == 256, path
+    return table
+
+
+def glyph_pixels(bitmap, height):
+    """8 x height matrix of 0/1, bit 0 is the leftmost column"""
+    return [[(bitmap[y] >> x) & 1 for x in range(8)] for y in range(height)]
+
+
+def scale_alpha(pixels, scale, bpp):
+    """bilinear upscale, threshold on a supersampled grid, box filter down"""
+    h, w = len(pixels), len(pixels[0])
+    levels = (1 << bpp) - 1
+    n = scale * SUPERSAMPLE
+
+    def sample(fx, fy):
+        # bilinear interpolation between pixel centers, 0 outside
+        fx -= 0.5
+        fy -= 0.5
+        x0, y0 = int(fx // 1), int(fy // 1)
+        ax, ay = fx - x0, fy - y0
+
+        def p(x, y):
+            return pixels[y][x] if 0 <= x < w and 0 <= y < h else 0
+
+        top = p(x0, y0) * (1 - ax) + p(x0 + 1, y0) * ax
+        bottom = p(x0, y0 + 1) * (1 - ax) + p(x0 + 1, y0 + 1) * ax
+        return top * (1 - ay) + bottom * ay
+
+    out = []
+    for y in range(h * scale):
+        row = []
+        for x in range(w * scale):
+            hits = 0
+            for sy in range(SUPERSAMPLE):
+                for sx in range(SUPERSAMPLE):
+                    fx = (x * SUPERSAMPLE + sx + 0.5) / n
+                    fy = (y * SUPERSAMPLE + sy + 0.5) / n
+                    hits += sample(fx, fy) >= 0.5
+            row.append((hits * levels + SUPERSAMPLE * SUPERSAMPLE // 2)
+                       // (SUPERSAMPLE * SUPERSAMPLE))
+        out.append(row)
+    return out
+
+
+def trim(pixels):
+    """drop empty columns on both sides, returns (pixels, width)"""
+    cols = [x for x in range(len(pixels[0])) if any(r[x] for r in pixels)]
+    if not cols:
+        return [], 0
+    left, right = cols[0], cols[-1]
+    return [r[left:right + 1] for r in pixels], right - left + 1
+
+
+def rle(pixels, bpp):
+    maxrun = 1 << (8 - bpp)
+    data = []
+    flat = [v for row in pixels for v in row]
+    i = 0
+    while i < len(flat):
+        v, n = flat[i], 1
+        while i + n < len(flat) and flat[i + n] == v and n < maxrun:
+            n += 1
+        data.append((v << (8 - bpp)) | (n - 1))
+        i += n
+    return data
+
+
+def build(root, name, height, scale, bpp, chars):
+    psf = load_psf(root, height)
+    codes = sorted(ord(c) if len(c) == 1 else c for c in chars)
+    first, last = codes[0], codes[-1]
+    glyphs, data = [], []
+    space = max(2, 4 * scale)
+
+    for code in range(first, last + 1):
+        if code not in codes:
+            glyphs.append((0, 0, 0))            # not in the font
+            continue
+        pixels = glyph_pixels(psf[code], height)
+        if scale > 1 or bpp > 1:
+            pixels = scale_alpha(pixels, scale, bpp)
+        pixels, width = trim(pixels)
+        if not width:
+            glyphs.append((0, 0, space))        # blank, advance only
+            continue
+        glyphs.append((len(data), width, width + scale))
+        data += rle(pixels, bpp)
+
+    assert len(data) < 0x10000, name
+    return {'name': name, 'height': height * scale, 'bpp': bpp,
+            'first': first, 'last': last, 'glyphs': glyphs, 'data': data}
+
+
+HEADER = '''/**
+  ******************************************************************************
+  * File Name          : %s
+  * Description        : This file contains %s
+  *                      generated by tools/fontgen.py, do not edit
+  ******************************************************************************
+  *
+  * COPYRIGHT(c) 2016 Roman Stepanov
+  *
+  * Redistribution and use in source and binary forms, with or without modification,
+  * are permitted provided that the following conditions are met:
+  *   1. Redistributions of source code must retain the above copyright notice,
+  *      this list of conditions and the following disclaimer.
+  *   2. Redistributions in binary form must reproduce the above copyright notice,
+  *      this list of conditions and the following disclaimer in the documentation
+  *      and/or other materials provided with the distribution.
+  *   3. Neither the name of STMicroelectronics nor the names of its contributors
+  *      may be used to endorse or promote products derived from this software
+  *      without specific prior written permission.
+  *
+  * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+  * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+  * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+  * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+  * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+  * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+  * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+  * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+  *
+  ******************************************************************************
+  */
+'''
+
+FOOTER = '\n/************************ (C) COPYRIGHT Roman Stepanov *****END OF FILE****/\n'
+
+
+def emit(root, fonts):
+    src = [HEADER % ('fonts.c', 'generated font tables'), '#include "fonts.h"\n']
+    for f in fonts:
+        src.append('\nstatic const uint8_t %s_data[%d] = {' % (f['name'], len(f['data'])))
+        for i in range(0, len(f['data']), 16):
+            src.append('\t' + ', '.join('0x%02x' % b for b in f['data'][i:i + 16]) + ',')
+        src.append('};\n')
+        src.append('static const font_glyph_t %s_glyphs[%d] = {' % (f['name'], len(f['glyphs'])))
+        for i, (offset, width, advance) in enumerate(f['glyphs']):
+            src.append('\t{ %5d, %2d, %2d },\t// 0x%02x' % (offset, width, advance, f['first'] + i))
+        src.append('};\n')
+        src.append('const font_t %s = {\n\t%d, %d, 0x%02x, 0x%02x, %s_glyphs, %s_data\n};'
+                   % (f['name'], f['height'], f['bpp'], f['first'], f['last'],
+                      f['name'], f['name']))
+    open(os.path.join(root, 'Src', 'fonts.c'), 'w').write('\n'.join(src) + '\n' + FOOTER)
+
+    hdr = [HEADER % ('fonts.h', 'generated font declarations'),
+           '/* Define to prevent recursive inclusion -------------------------------------*/',
+           '#ifndef __FONTS_H', '#define __FONTS_H', '', '#include "lcd.h"', '']
+    for f in fonts:
+        hdr.append('extern const font_t %s;\t// %u px, %u bpp, %u bytes'
+                   % (f['name'], f['height'], f['bpp'], len(f['data'])))
+    hdr += ['', '#endif /* __FONTS_H */']
+    open(os.path.join(root, 'Inc', 'fonts.h'), 'w').write('\n'.join(hdr) + FOOTER)
+
+
+def main():
+    root = sys.argv[1] if len(sys.argv) > 1 else \
+        os.path.join(os.path.dirname(os.path.abspath(__file__)), '..')
+    fonts = [build(root, *f) for f in FONTS]
+    emit(root, fonts)
+    for f in fonts:
+        print('%-16s %3u px %u bpp %5u bytes' % (f['name'], f['height'], f['bpp'], len(f['data'])))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,107 @@
+/*
+ * gesture.c - host replay of touch traces through the gesture recognizer
+ *
+ * Feeds every trace through Src/lcd_gesture.c and prints the gestures it
+ * reports. A trace is a text file of samples in screen pixels, the way the
+ * touch task hands them over after Lcd_Translate_Touch_Pos():
+ *
+ *   # expect TAP LONG_PRESS ...      gestures other than MOVE, in order
+ *   <ms> <x> <y> D|M|U               one sample: down, move or up
+ *
+ * MOVE is checked by its sum: the deltas of a trace must add up to the way
+ * the pen went from the first MOVE on. The exit code is the number of
+ * traces whose gestures differ from their expect line.
+ *
+ * build: gcc -std=gnu99 -O2 -DLCD_HOST=1 -IInc -o gesture tools/gesture.c \
+ *            Src/lcd_gesture.c
+ * usage: ./gesture [-v] <trace> ...  (tools/traces has a set)
+ *
+ * COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "lcd.h"
+
+static const char *names[] = {
+	"NONE", "MOVE", "TAP", "LONG_PRESS", "SWIPE_LEFT", "SWIPE_RIGHT",
+	"SWIPE_UP", "SWIPE_DOWN", "FLING"
+};
+
+static int replay(const char *path, int verbose) {
+
+	FILE *f = fopen(path, "r");
+	char line[256], expect[256] = "", got[256] = "";
+	int moves = 0, sum_x = 0, sum_y = 0, last_x = 0, last_y = 0, ok = 1;
+	gesture_state_t state;
+	gesture_t g;
+
+	if (!f) {
+		perror(path);
+		return 0;
+	}
+
+	Lcd_Gesture_Reset(&state);
+
+	while (fgets(line, sizeof(line), f)) {
+
+		unsigned long time;
+		int x, y;
+		char c;
+
+		if (!strncmp(line, "# expect", 8)) {
+			snprintf(expect, sizeof(expect), "%s", line + 8 + strspn(line + 8, " "));
+			expect[strcspn(expect, "\r\n")] = '\0';
+			continue;
+		}
+		if (sscanf(line, "%lu %d %d %c", &time, &x, &y, &c) != 4)
+			continue;
+
+		uint8_t touch = (c == 'D') ? TOUCH_DOWN : (c == 'M') ? TOUCH_MOVE : TOUCH_UP;
+		uint8_t type = Lcd_Gesture_Feed(&state, time, x, y, touch, &g);
+
+		if (type == GESTURE_MOVE) {
+			if (!moves++) {
+				sum_x = g.x - g.dx;
+				sum_y = g.y - g.dy;
+			}
+			sum_x += g.dx;
+			sum_y += g.dy;
+			last_x = g.x;
+			last_y = g.y;
+
+		} else if (type != GESTURE_NONE) {
+			size_t n = strlen(got);
+			snprintf(got + n, sizeof(got) - n, "%s%s", n ? " " : "", names[type]);
+		}
+
+		if (verbose && type != GESTURE_NONE)
+			printf("  %6lu %-11s %4d %4d %6d %6d\n", time, names[type], g.x, g.y, g.dx, g.dy);
+	}
+	fclose(f);
+
+	if (moves && (sum_x != last_x || sum_y != last_y))
+		ok = 0;
+	if (strcmp(expect, got))
+		ok = 0;
+
+	printf("%-32s %-4s %3d moves  %s\n", path, ok ? "ok" : "FAIL", moves, got);
+	if (!ok)
+		printf("%-32s      expected   %s\n", "", expect);
+	return !ok;
+}
+
+int main(int argc, char **argv) {
+
+	int verbose = 0, failed = 0;
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-v"))
+			verbose = 1;
+		else
+			failed += replay(argv[i], verbose);
+	}
+
+	return failed;
+}
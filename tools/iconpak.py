@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+#
+# iconpak.py - packs the bmp_*.bin icons into one mks_pic.pak
+#
+# The firmware opens the pack once (see xIconPackHeader_t in Inc/ui_icon.h)
+# and draws an icon with one seek instead of an f_open() per icon:
+#
+#   'MKSP', count, 0                             8 bytes, little endian
+#   count x (hash, offset, size, width, height, format, 0, 0, 0)   20 bytes
+#   icon file images, each starting on a 512 byte sector
+#
+# Entries are sorted by hash, the FNV-1a of the lower case file name. Raw
+# RGB565 and indexed icons (tools/iconpal.py) are stored as they are. Put
+# the pack next to the mks_pic folder on the SD card, it is copied to the
+# flash together with the icons.
+#
+# usage: tools/iconpak.py [-w width] [-o mks_pic.pak] mks_pic/*.bin
+#
+# COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'MKSP'
+ICON_MAGIC = b'MKSI'
+ICON_WIDTH = 78
+SECTOR = 512
+
+ICON_RAW = 0
+ICON_INDEXED = 1
+
+
+def name_hash(name):
+    h = 2166136261
+    for c in name.lower().encode('latin-1'):
+        h = ((h ^ c) * 16777619) & 0xffffffff
+    return h
+
+
+def icon_info(data, width):
+    if data[:4] == ICON_MAGIC:
+        w, h = struct.unpack('<HH', data[6:10])
+        return w, h, ICON_INDEXED
+    if not data or len(data) % (2 * width):
+        return None
+    return width, len(data) // (2 * width), ICON_RAW
+
+
+def main():
+    parser = argparse.ArgumentParser(description='pack icons into mks_pic.pak')
+    parser.add_argument('-w', '--width', type=int, default=ICON_WIDTH,
+                        help='width of raw RGB565 icons')
+    parser.add_argument('-o', '--output', default='mks_pic.pak')
+    parser.add_argument('icons', nargs='+')
+    args = parser.parse_args()
+
+    entries = {}
+    for path in args.icons:
+        name = os.path.basename(path)
+        data = open(path, 'rb').read()
+        info = icon_info(data, args.width)
+        if not info:
+            print('%-24s skipped' % name)
+            continue
+        h = name_hash(name)
+        if h in entries:
+            sys.exit('%s: hash collides with %s' % (name, entries[h][0]))
+        entries[h] = (name, data) + info
+
+    table = 8 + 20 * len(entries)
+    offset = (table + SECTOR - 1) // SECTOR * SECTOR
+    head = bytearray(MAGIC + struct.pack('<HH', len(entries), 0))
+    body = bytearray()
+
+    for h in sorted(entries):
+        name, data, width, height, fmt = entries[h]
+        head += struct.pack('<IIIHHB3x', h, offset + len(body), len(data), width, height, fmt)
+        body += data
+        body += bytes(-len(body) % SECTOR)
+        print('%-24s %08x %3ux%-3u %s %6u bytes'
+              % (name, h, width, height, 'indexed' if fmt else 'raw    ', len(data)))
+
+    head += bytes(offset - len(head))
+    open(args.output, 'wb').write(head + body)
+    print('%s: %u icons, %u bytes' % (args.output, len(entries), len(head) + len(body)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#
+# iconpal.py - converts raw RGB565 icons (bmp_*.bin) to indexed icons
+#
+# The firmware recognizes the output by its header (see xIconHeader_t in
+# Inc/ui_icon.h) and expands the indices through the palette while streaming to
+# GRAM, raw icons keep working:
+#
+#   'MKSI', bpp, flags, width, height, colors    12 bytes, little endian
+#   colors x RGB565                              palette
+#   width * height indices                       8 or 4 bits, high nibble first
+#
+# Icons with up to 16 (256) colors are converted losslessly to 4 (8) bpp,
+# others are reduced by a weighted median cut in RGB565 space. The indices
+# are run-length coded (flags = 1) when that is smaller, see ICON_RLE:
+#
+#   0x00..0x7f, packed indices                   literal of n + 1 pixels
+#   0x80..0xff, index                            run of (n & 0x7f) + 2 pixels
+#
+# An icon that would come out larger than the input is left out.
+#
+# usage: tools/iconpal.py [-b 4|8] [--plain] [-w width] [-o outdir] bmp_*.bin
+#
+# COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = b'MKSI'
+ICON_WIDTH = 78
+ICON_RLE = 0x01
+
+
+def rgb(c):
+    return (c >> 11) & 0x1f, (c >> 5) & 0x3f, c & 0x1f
+
+
+def median_cut(histogram, colors):
+    """histogram: {rgb565: count}, returns (palette, {rgb565: index})"""
+    boxes = [list(histogram.items())]
+
+    while len(boxes) < colors:
+        # split the box with the widest channel weighted by its population
+        best, best_score, best_channel = None, 0, 0
+        for i, box in enumerate(boxes):
+            if len(box) < 2:
+                continue
+            population = sum(n for _, n in box)
+            for channel in range(3):
+                values = [rgb(c)[channel] << (channel != 1) for c, _ in box]
+                score = (max(values) - min(values)) * population
+                if score > best_score:
+                    best, best_score, best_channel = i, score, channel
+        if best is None:
+            break
+
+        box = sorted(boxes.pop(best), key=lambda e: rgb(e[0])[best_channel])
+        half, acc, cut = sum(n for _, n in box) / 2, 0, 1
+        for cut in range(1, len(box)):
+            acc += box[cut - 1][1]
+            if acc >= half:
+                break
+        boxes += [box[:cut], box[cut:]]
+
+    palette, index = [], {}
+    for i, box in enumerate(boxes):
+        population = sum(n for _, n in box)
+        mean = [sum(rgb(c)[ch] * n for c, n in box) / population for ch in range(3)]
+        palette.append((int(mean[0] + 0.5) << 11) | (int(mean[1] + 0.5) << 5) | int(mean[2] + 0.5))
+        for c, _ in box:
+            index[c] = i
+    return palette, index
+
+
+def pack(indices, bpp):
+    if bpp == 4:
+        indices = indices + [0] * (len(indices) & 1)
+        return bytes((indices[i] << 4) | indices[i + 1] for i in range(0, len(indices), 2))
+    return bytes(indices)
+
+
+def rle(indices, bpp):
+    out, literal, i = bytearray(), [], 0
+
+    def flush():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(pack(chunk, bpp))
+
+    while i < len(indices):
+        j = i + 1
+        while j < len(indices) and j - i < 129 and indices[j] == indices[i]:
+            j += 1
+        if j - i >= 3:
+            flush()
+            out += bytes((0x80 | (j - i - 2), indices[i]))
+        else:
+            literal += indices[i:j]
+        i = j
+    flush()
+    return bytes(out)
+
+
+def convert(data, width, bpp, plain=False):
+    pixels = list(struct.unpack('<%dH' % (len(data) // 2), data))
+    height = len(pixels) // width
+
+    histogram = {}
+    for c in pixels:
+        histogram[c] = histogram.get(c, 0) + 1
+
+    if not bpp:
+        bpp = 4 if len(histogram) <= 16 else 8
+
+    if len(histogram) <= 1 << bpp:
+        palette = sorted(histogram, key=histogram.get, reverse=True)
+        index = {c: i for i, c in enumerate(palette)}
+    else:
+        palette, index = median_cut(histogram, 1 << bpp)
+
+    indices = [index[c] for c in pixels]
+    body, flags = pack(indices, bpp), 0
+    if not plain:
+        coded = rle(indices, bpp)
+        if len(coded) < len(body):
+            body, flags = coded, ICON_RLE
+
+    out = bytearray(MAGIC + struct.pack('<BBHHH', bpp, flags, width, height, len(palette)))
+    out += struct.pack('<%dH' % len(palette), *palette)
+    out += body
+
+    lossy = len(histogram) > len(palette)
+    return bytes(out), bpp, flags, len(histogram), lossy
+
+
+def main():
+    parser = argparse.ArgumentParser(description='RGB565 icon to indexed icon')
+    parser.add_argument('-b', '--bpp', type=int, choices=(4, 8), default=0,
+                        help='bits per pixel, default: 4 if the icon has <= 16 colors')
+    parser.add_argument('--plain', action='store_true', help='no run-length coding')
+    parser.add_argument('-w', '--width', type=int, default=ICON_WIDTH)
+    parser.add_argument('-o', '--outdir', help='output directory, default: in place')
+    parser.add_argument('icons', nargs='+')
+    args = parser.parse_args()
+
+    total_in = total_out = 0
+    for path in args.icons:
+        data = open(path, 'rb').read()
+        if data[:4] == MAGIC or len(data) % (2 * args.width):
+            print('%-24s skipped' % os.path.basename(path))
+            continue
+
+        out, bpp, flags, colors, lossy = convert(data, args.width, args.bpp, args.plain)
+        if len(out) >= len(data):
+            out = data
+
+        target = os.path.join(args.outdir, os.path.basename(path)) if args.outdir else path
+        open(target, 'wb').write(out)
+
+        total_in += len(data)
+        total_out += len(out)
+        print('%-24s %5u colors %u bpp%s%s %6u -> %6u bytes %5.1fx'
+              % (os.path.basename(path), colors, bpp, ' rle' if flags else '',
+                 ' lossy' if lossy else '', len(data), len(out), len(data) / len(out)))
+
+    if total_in:
+        print('total %u -> %u bytes (%.1fx)' % (total_in, total_out, total_in / total_out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,282 @@
+/*
+ * lcdshot.c - host renderer for the MKS-TFT display code
+ *
+ * Builds Src/lcd.c against the emulated ILI9325 of Src/lcd_host.c, draws a
+ * set of reference screens, writes them as PPM and prints the bus cost of
+ * every screen (write strobes are commands plus data, the primitive screens
+ * count only the primitive, not the cleared background). The images are compared with the golden ones of tools/golden
+ * (or the directory given) and the exit code is the number of screens that
+ * differ or have no golden image. Run it from the top of the tree.
+ * With -b it times the text renderers instead: glyphs/s of the host build
+ * and bus strobes per glyph for the 8x16 bitmap font and every compiled one.
+ *
+ * build: gcc -std=gnu99 -O2 -DLCD_HOST=1 -IInc -o lcdshot tools/lcdshot.c \
+ *            Src/lcd.c Src/lcd_dcs.c Src/lcd_host.c Src/fonts.c Src/cp866-8x*.c
+ * usage: ./lcdshot <output dir> [golden dir]
+ *        ./lcdshot -b
+ *
+ * COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "lcd.h"
+#include "fonts.h"
+
+static void screen_fill(void) {
+
+	Lcd_Fill_Screen(Lcd_Get_RGB565(0, 0, 31));
+}
+
+static void screen_menu(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Put_Text_Opaque(0, 0, 16, "MyFirmware>Set>About", 0xffffu, 0);
+
+	for (int i = 0; i < 8; i++) {
+		uint16_t x = 1 + (i & 3) * 80, y = (i < 4) ? 16 : 18 + 104;
+
+		Lcd_Fill_Round_Rect(x, y, x + 77, y + 103, 8, Lcd_Get_RGB565(i * 4, 32, 31 - i * 4));
+		Lcd_Put_Text(x + 8, y + 44, 16, "icon", 0xffffu);
+	}
+}
+
+static void screen_shapes(void) {
+
+	Lcd_Fill_Screen(0);
+	for (int i = 0; i < 320; i += 16)
+		Lcd_Line(0, 0, i, 239, Lcd_Get_RGB565(31, i / 5, 0));
+
+	Lcd_Circle(240, 60, 50, 0xffffu);
+	Lcd_Fill_Circle(240, 60, 30, Lcd_Get_RGB565(0, 63, 0));
+	Lcd_Arc(240, 180, 50, 40, 30, 300, Lcd_Get_RGB565(31, 32, 0));
+	Lcd_Round_Rect(100, 150, 180, 220, 10, 0xffffu);
+}
+
+/* one screen per span primitive, the background is not counted */
+static void screen_line(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	for (int i = 0; i < 320; i += 16)
+		Lcd_Line(0, 0, i, 239, 0xffffu);
+	for (int i = 0; i < 240; i += 16)
+		Lcd_Line(319, 0, 0, i, Lcd_Get_RGB565(31, 32, 0));
+	Lcd_Line(0, 120, 319, 120, Lcd_Get_RGB565(0, 63, 0));
+	Lcd_Line(160, 0, 160, 239, Lcd_Get_RGB565(0, 63, 0));
+}
+
+static void screen_circle(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	for (int r = 10; r < 120; r += 20)
+		Lcd_Circle(160, 120, r, 0xffffu);
+}
+
+static void screen_fcircle(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	Lcd_Fill_Circle(80, 120, 70, Lcd_Get_RGB565(0, 63, 0));
+	Lcd_Fill_Circle(240, 120, 30, Lcd_Get_RGB565(31, 0, 0));
+	Lcd_Fill_Circle(240, 40, 5, 0xffffu);
+}
+
+static void screen_arc(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	Lcd_Arc(80, 120, 70, 50, 30, 300, Lcd_Get_RGB565(31, 32, 0));
+	Lcd_Arc(240, 120, 70, 66, 0, 90, 0xffffu);
+	Lcd_Arc(240, 120, 50, 30, 135, 360, Lcd_Get_RGB565(0, 32, 31));
+}
+
+static void screen_rrect(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	for (int i = 0; i < 4; i++)
+		Lcd_Round_Rect(10 + i * 20, 10 + i * 20, 309 - i * 20, 229 - i * 20, 4 + i * 6, 0xffffu);
+}
+
+static void screen_frrect(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Host_Stats(NULL, 1);
+	for (int i = 0; i < 8; i++) {
+		uint16_t x = 1 + (i & 3) * 80, y = (i < 4) ? 16 : 18 + 104;
+
+		Lcd_Fill_Round_Rect(x, y, x + 77, y + 103, 8, Lcd_Get_RGB565(i * 4, 32, 31 - i * 4));
+	}
+}
+
+static void screen_fonts(void) {
+
+	Lcd_Fill_Screen(0);
+	Lcd_Put_Font_Text(0, 0, &font_prop16, "Proportional 16px, 1 bpp", 0xffffu, 0);
+	Lcd_Put_Font_Text(0, 24, &font_digits32, "215.5C", Lcd_Get_RGB565(31, 32, 0), 0);
+	Lcd_Put_Font_Text(0, 64, &font_digits48, "12:34", Lcd_Get_RGB565(0, 63, 31), 0);
+}
+
+static void screen_strip(void) {
+
+	lcd_strip_t strip;
+
+	if (!Lcd_Strip_Begin(&strip, 0, 0, LCD_MAX_X, LCD_MAX_Y))
+		return;
+
+	do {
+		Lcd_Strip_Fill_Rect(&strip, 0, 0, LCD_MAX_X - 1, LCD_MAX_Y - 1, 0x001fu);
+		Lcd_Strip_Blend_Rect(&strip, 0, 32, LCD_MAX_X - 1, 47, 0xffffu, 64);
+
+		for (int row = 0; row < 13; row++) {
+			char name[24];
+
+			snprintf(name, sizeof(name), " file%02d.gcode", row);
+			Lcd_Strip_Text(&strip, 0, row * 16, 16, name, 0xffffu);
+		}
+
+		Lcd_Strip_Font_Text(&strip, 200, 100, &font_digits48, "42", 0xffffu);
+	} while (Lcd_Strip_Next(&strip));
+}
+
+static const struct {
+	const char *name;
+	void (*draw)(void);
+} screens[] = {
+	{ "fill",   screen_fill },
+	{ "menu",   screen_menu },
+	{ "shapes", screen_shapes },
+	{ "line",   screen_line },
+	{ "circle", screen_circle },
+	{ "fcircle", screen_fcircle },
+	{ "arc",    screen_arc },
+	{ "rrect",  screen_rrect },
+	{ "frrect", screen_frrect },
+	{ "fonts",  screen_fonts },
+	{ "strip",  screen_strip },
+};
+
+static int same_file(const char *a, const char *b) {
+
+	FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+	int ca, cb, same = fa && fb;
+
+	while (same && (ca = fgetc(fa)) == (cb = fgetc(fb)) && ca != EOF)
+		;
+	same = same && ca == cb;
+
+	if (fa) fclose(fa);
+	if (fb) fclose(fb);
+
+	return same;
+}
+
+/* text benchmark, ~0.2 s per renderer */
+#define BENCH_NS	200000000LL
+
+static const char bench_text[] = "0123456789";
+static const char bench_prop[] = "The quick brown fox jumps";
+
+static const struct {
+	const char *name;
+	const font_t *font;		// NULL - 8x16 bitmap font
+	const char *text;
+} benches[] = {
+	{ "8x16",    NULL,           bench_prop },
+	{ "prop16",  &font_prop16,   bench_prop },
+	{ "digits32", &font_digits32, bench_text },
+	{ "digits48", &font_digits48, bench_text },
+};
+
+static long long bench_now(void) {
+
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static int bench_fonts(void) {
+
+	lcd_host_stats_t stats;
+
+	Lcd_Init(LCD_LANDSCAPE_CL);
+
+	printf("%-8s %4s %12s %12s %9s\n", "font", "bpp", "glyphs", "glyphs/s", "strobes/g");
+
+	for (size_t i = 0; i < sizeof(benches) / sizeof(benches[0]); i++) {
+		long long start, elapsed;
+		unsigned long glyphs = 0;
+		size_t len = strlen(benches[i].text);
+
+		Lcd_Fill_Screen(0);
+		Lcd_Host_Stats(NULL, 1);
+		start = bench_now();
+
+		do {
+			for (int n = 0; n < 100; n++) {
+				if (benches[i].font)
+					Lcd_Put_Font_Text(0, 0, benches[i].font, benches[i].text, 0xffffu, 0);
+				else
+					Lcd_Put_Text_Opaque(0, 0, 16, (char *) benches[i].text, 0xffffu, 0);
+			}
+			glyphs += 100 * len;
+			elapsed = bench_now() - start;
+		} while (elapsed < BENCH_NS);
+
+		Lcd_Host_Stats(&stats, 1);
+
+		printf("%-8s %4u %12lu %12.0f %9.1f\n", benches[i].name,
+				benches[i].font ? benches[i].font->bpp : 1, glyphs,
+				glyphs * 1e9 / elapsed, (double) (stats.commands + stats.data) / glyphs);
+	}
+
+	return 0;
+}
+
+int main(int argc, char *argv[]) {
+
+	lcd_host_stats_t stats;
+	char path[256], golden[256];
+	const char *golden_dir = "tools/golden";
+	int failed = 0;
+
+	if (argc < 2) {
+		fprintf(stderr, "usage: %s <output dir> [golden dir] | -b\n", argv[0]);
+		return 255;
+	}
+	if (!strcmp(argv[1], "-b"))
+		return bench_fonts();
+	if (argc > 2)
+		golden_dir = argv[2];
+
+	Lcd_Init(LCD_LANDSCAPE_CL);
+
+	printf("%-8s %9s %9s %9s %9s %9s\n", "screen", "commands", "data", "strobes", "reads",
+			"windows");
+
+	for (size_t i = 0; i < sizeof(screens) / sizeof(screens[0]); i++) {
+
+		Lcd_Host_Stats(NULL, 1);
+		screens[i].draw();
+		Lcd_Host_Stats(&stats, 1);
+
+		printf("%-8s %9u %9u %9u %9u %9u\n", screens[i].name, stats.commands, stats.data,
+				stats.commands + stats.data, stats.reads, stats.windows);
+
+		snprintf(path, sizeof(path), "%s/%s.ppm", argv[1], screens[i].name);
+		Lcd_Host_Dump_PPM(path);
+
+		snprintf(golden, sizeof(golden), "%s/%s.ppm", golden_dir, screens[i].name);
+		if (!same_file(path, golden)) {
+			printf("%-8s differs from %s\n", screens[i].name, golden);
+			failed++;
+		}
+	}
+
+	return failed;
+}
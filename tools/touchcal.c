@@ -0,0 +1,255 @@
+/*
+ * touchcal.c - host accuracy test of the touch calibration
+ *
+ * Builds the calibration part of Src/lcd_touch.c and checks
+ *   - the default matrix against the divide per axis mapping it replaced,
+ *     in all four orientations
+ *   - calibrations of simulated panels: each panel is a random affine map
+ *     from screen to raw (gain, offset, rotation, shear), the calibration
+ *     targets are tapped with noise, and the fitted matrix is measured
+ *     over the whole screen, with 3 and with 5 points
+ *   - that collinear points are refused
+ * The exit code is the number of failed checks.
+ *
+ * build: gcc -std=gnu99 -O2 -DLCD_HOST=1 -DLCD_ORIENTATION=-1 -IInc -o touchcal \
+ *            tools/touchcal.c Src/lcd_touch.c -lm
+ * usage: ./touchcal [panels]
+ *
+ * COPYRIGHT(c) 2016 Roman Stepanov, see LICENSE
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "lcd.h"
+
+#define NOISE		96		// raw units a tap lands off its target, at most (~1 px)
+#define LIMIT_3		5.0		// px the fit may be off anywhere, 3 points
+#define LIMIT_5		3.0		// 5 points
+
+static uint8_t orientation = LCD_LANDSCAPE_CL;
+
+uint8_t Lcd_Orientation(void) {
+
+	return orientation;
+}
+
+/* the mapping before the calibration, as it was in Src/lcd.c */
+static void legacy(uint16_t raw_x, uint16_t raw_y, uint16_t *x, uint16_t *y) {
+
+	if (raw_x < TOUCH_X_LOW)  raw_x = TOUCH_X_LOW;
+	if (raw_x > TOUCH_X_HIGH) raw_x = TOUCH_X_HIGH;
+	if (raw_y < TOUCH_Y_LOW)  raw_y = TOUCH_Y_LOW;
+	if (raw_y > TOUCH_Y_HIGH) raw_y = TOUCH_Y_HIGH;
+
+	raw_x -= TOUCH_X_LOW;
+	raw_y -= TOUCH_Y_LOW;
+
+	switch (orientation) {
+	case LCD_LANDSCAPE_CL:
+		*x = 320 - (raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW));
+		*y = raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW);
+		break;
+	case LCD_LANDSCAPE_CR:
+		*x = raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW);
+		*y = 240 - (raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW));
+		break;
+	case LCD_PORTRAIT_CDN:
+		*x = raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW);
+		*y = raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW);
+		break;
+	case LCD_PORTRAIT_CUP:
+	default:
+		*x = 240 - (raw_y * 240 / (TOUCH_Y_HIGH - TOUCH_Y_LOW));
+		*y = 320 - (raw_x * 320 / (TOUCH_X_HIGH - TOUCH_X_LOW));
+		break;
+	}
+}
+
+static int check_default(void) {
+
+	int failed = 0;
+
+	Lcd_Touch_Set_Calibration(NULL);
+
+	for (orientation = 0; orientation < 4; orientation++) {
+
+		int worst = 0;
+
+		for (uint32_t rx = TOUCH_X_LOW; rx <= TOUCH_X_HIGH; rx += 8)
+			for (uint32_t ry = TOUCH_Y_LOW; ry <= TOUCH_Y_HIGH; ry += 64) {
+
+				uint16_t x, y, lx, ly;
+				Lcd_Translate_Touch_Pos(rx, ry, &x, &y);
+				legacy(rx, ry, &lx, &ly);
+
+				// the old mapping reached one past the last pixel
+				lx = MIN(lx, LCD_MAX_X - 1);
+				ly = MIN(ly, LCD_MAX_Y - 1);
+				worst = MAX(worst, abs(x - lx));
+				worst = MAX(worst, abs(y - ly));
+			}
+
+		printf("default, orientation %u: %d px from the divide per axis\n", orientation, worst);
+		failed += worst > 1;
+	}
+
+	orientation = LCD_LANDSCAPE_CL;
+	return failed;
+}
+
+/* screen to raw of a simulated panel */
+typedef struct {
+	double m[2][3];
+} panel_t;
+
+static void panel_random(panel_t *p) {
+
+	double gx = (TOUCH_X_HIGH - TOUCH_X_LOW) / 320.0 * (0.85 + 0.3 * drand48());
+	double gy = (TOUCH_Y_HIGH - TOUCH_Y_LOW) / 240.0 * (0.85 + 0.3 * drand48());
+	double rot = (drand48() - 0.5) * 4 * M_PI / 180;
+	double shear = (drand48() - 0.5) * 0.04;
+
+	// landscape CL: raw x falls with screen x, raw y follows screen y
+	p->m[0][0] = -gx * cos(rot);
+	p->m[0][1] = gx * (sin(rot) + shear);
+	p->m[0][2] = TOUCH_X_HIGH + (drand48() - 0.5) * 3000;
+	p->m[1][0] = gy * sin(rot);
+	p->m[1][1] = gy * cos(rot);
+	p->m[1][2] = TOUCH_Y_LOW + (drand48() - 0.5) * 3000;
+}
+
+/* 0 if the point is off the raw range, the conversion clips */
+static int panel_raw(const panel_t *p, double x, double y, int noise, touch_point_t *raw) {
+
+	int inside = 1;
+
+	for (int i = 0; i < 2; i++) {
+		double r = p->m[i][0] * x + p->m[i][1] * y + p->m[i][2];
+		if (noise)
+			r += (drand48() * 2 - 1) * noise;
+		// 12 bit conversion, left aligned the way the sampler delivers it
+		long v = lround(r / 8) * 8;
+		if (v < 0 || v > 32760)
+			inside = 0;
+		v = (v < 0) ? 0 : (v > 32760) ? 32760 : v;
+		if (i)
+			raw->y = v;
+		else
+			raw->x = v;
+	}
+
+	return inside;
+}
+
+/* px the matrix is off the panel anywhere on the screen the panel covers */
+static double fit_error(const touch_cal_t *cal, const panel_t *p) {
+
+	double worst = 0;
+
+	for (int y = 0; y < 240; y += 4)
+		for (int x = 0; x < 320; x += 4) {
+
+			touch_point_t raw;
+			int16_t mx, my;
+
+			if (!panel_raw(p, x, y, 0, &raw))
+				continue;
+			Lcd_Touch_Map(cal, raw.x, raw.y, &mx, &my);
+			worst = fmax(worst, hypot(mx - x, my - y));
+		}
+
+	return worst;
+}
+
+static int check_panels(int panels) {
+
+	const touch_point_t targets[LCD_TOUCH_CAL_POINTS] = {
+		{ LCD_TOUCH_CAL_INSET, LCD_TOUCH_CAL_INSET },
+		{ 320 - LCD_TOUCH_CAL_INSET, LCD_TOUCH_CAL_INSET },
+		{ 320 - LCD_TOUCH_CAL_INSET, 240 - LCD_TOUCH_CAL_INSET },
+		{ LCD_TOUCH_CAL_INSET, 240 - LCD_TOUCH_CAL_INSET },
+		{ 160, 120 }
+	};
+	double worst[2] = { 0, 0 }, sum[2] = { 0, 0 }, uncal = 0;
+	int failed = 0;
+
+	Lcd_Touch_Set_Calibration(NULL);
+
+	for (int n = 0; n < panels; n++) {
+
+		panel_t p;
+		touch_point_t raw[LCD_TOUCH_CAL_POINTS];
+		int i, inside;
+
+		// a panel that clips at a target is not a calibration test
+		do {
+			panel_random(&p);
+			for (inside = 1, i = 0; i < LCD_TOUCH_CAL_POINTS; i++)
+				inside &= panel_raw(&p, targets[i].x, targets[i].y, NOISE, &raw[i]);
+		} while (!inside);
+
+		for (int k = 0; k < 2; k++) {
+
+			touch_cal_t cal;
+			uint8_t points = k ? 5 : 3;
+
+			if (!Lcd_Touch_Calibrate(raw, targets, points, &cal)) {
+				printf("panel %d: %u points refused\n", n, points);
+				failed++;
+				continue;
+			}
+
+			double e = fit_error(&cal, &p);
+			worst[k] = fmax(worst[k], e);
+			sum[k] += e;
+			if (e > (k ? LIMIT_5 : LIMIT_3))
+				failed++;
+		}
+
+		// what the same panel gets without a calibration
+		double e = 0;
+		for (int y = 0; y < 240; y += 4)
+			for (int x = 0; x < 320; x += 4) {
+				touch_point_t r;
+				uint16_t tx, ty;
+				if (!panel_raw(&p, x, y, 0, &r))
+					continue;
+				Lcd_Translate_Touch_Pos(r.x, r.y, &tx, &ty);
+				e = fmax(e, hypot(tx - x, ty - y));
+			}
+		uncal = fmax(uncal, e);
+	}
+
+	printf("%d panels, +-%d raw tap noise, px off anywhere on the screen:\n", panels, NOISE);
+	printf("  uncalibrated  worst %6.2f\n", uncal);
+	printf("  3 points      worst %6.2f  mean %5.2f  limit %.1f\n", worst[0], sum[0] / panels, LIMIT_3);
+	printf("  5 points      worst %6.2f  mean %5.2f  limit %.1f\n", worst[1], sum[1] / panels, LIMIT_5);
+	return failed;
+}
+
+static int check_collinear(void) {
+
+	const touch_point_t raw[3] = { { 4000, 4000 }, { 16000, 16000 }, { 28000, 28000 } };
+	const touch_point_t screen[3] = { { 32, 32 }, { 160, 120 }, { 288, 208 } };
+	touch_cal_t cal;
+
+	int refused = !Lcd_Touch_Calibrate(raw, screen, 3, &cal);
+	printf("collinear points: %s\n", refused ? "refused" : "ACCEPTED");
+	return !refused;
+}
+
+int main(int argc, char **argv) {
+
+	int panels = (argc > 1) ? atoi(argv[1]) : 1000;
+	int failed = 0;
+
+	srand48(1);
+	failed += check_default();
+	failed += check_panels(panels);
+	failed += check_collinear();
+
+	printf("%d failed\n", failed);
+	return failed;
+}